@@ -33,7 +33,7 @@ OBJS = mate1ply.obj misc.obj timeman.obj $(EVAL_OBJ) position.obj \
 	 tt.obj main.obj move.obj \
 	 movegen.obj search.obj uci.obj movepick.obj thread.obj ucioption.obj \
 	 benchmark.obj book.obj \
-	 shogi.obj mate.obj problem.obj
+	 shogi.obj mate.obj dfpn.obj problem.obj
 
 CC=cl
 LD=link
@@ -47,7 +47,13 @@ LD=link
 # -DEVAL_APERY     nanopery(Apery̕]֐)
 #
 # -DTWIG           Apery(̎})̕]֐g
-# -DUSE_AVX2_EVAL  ]֐̌vZAVX߂g
+# -DUSE_AVX2_EVAL  ]l̍̉ZAVX2߂g(AVX2̂ȂCPUł͓Ȃ)
+#                  KPP̌vZ͎sCPU𔻒肵SSE4.1/AVX2/AVX-512ĝŁA
+#                  ʏ͎w肵ȂĂ悢
+# -DEVAL_MMAP      ]֐̃t@Cǂݍ܂ɃɃ}bv
+#                  (}VŕƂɕLłANȂ)
+# -DEVAL_COMPACT   KPPOp`ɋl߁A0̈ʒu`(KKP_compact.bin/KPP_compact.bin)g
+#                  (t@C΋Nxxx_synthesized.binBKPP̑傫񔼕ɂȂ)
 #
 # Visual C++IvV
 #
@@ -61,7 +67,7 @@ LD=link
 # /RTCs             X^bN t[ ^C `FbN
 # /RTCu             ĂȂ[Jϐ̃`FbN
 
-FLAGS = -DNDEBUG -D$(EVAL_TYPE) -DUSAPYON2 -DNANOHA -DCHK_PERFORM -DTWIG \
+FLAGS = -DNDEBUG -D$(EVAL_TYPE) -DUSAPYON2 -DNANOHA -DCHK_PERFORM -DTWIG -DEVAL_MMAP \
 	-DOLD_LOCKS /favor:AMD64 /EHsc /D_CRT_SECURE_NO_WARNINGS \
 	 /GL /Zc:forScope
 #CXXFLAGS=$(FLAGS) /MT /W4 /Wall /nologo /Od /GS /RTCsu
@@ -1,103 +0,0 @@
-#
-# Ȃ̂miniɂƂNANOHAMINI=1̑O#A
-# Ȃ̂nanoɂƂNANOHAMINI=1̑O#tANANOHANANO=1̑O#
-# nanoperyɂƂNANOPERY=1̑O#
-#
-#NANOHAMINI=1
-#NANOHANANO=1
-NANOPERY=1
-
-!IFDEF NANOHAMINI
-EVAL_TYPE=EVAL_MINI
-EVAL_OBJ=evaluate.obj
-EXE = nanohamini.exe
-PGD = nanohamini.pgd
-PGOLOG = nanohamini_prof.txt
-!ELSEIFDEF NANOHANANO
-EVAL_TYPE=EVAL_NANO
-EVAL_OBJ=evaluate.obj
-EXE = nanohanano.exe
-PGD = nanohanano.pgd
-PGOLOG = nanohanano_prof.txt
-!ELSEIFDEF NANOPERY
-EVAL_TYPE=EVAL_APERY
-EVAL_OBJ=evaluate_apery.obj
-EXE = usapyon2AVX.exe
-PGD = usapyon2AVX.pgd
-PGOLOG = usapyon2AVX_prof.txt
-!ELSE
-!ERROR undefined eval_type
-!ENDIF
-
-OBJS = mate1ply.obj misc.obj timeman.obj $(EVAL_OBJ) position.obj \
-	 tt.obj main.obj move.obj \
-	 movegen.obj search.obj uci.obj movepick.obj thread.obj ucioption.obj \
-	 benchmark.obj book.obj \
-	 shogi.obj mate.obj problem.obj
-
-CC=cl
-LD=link
-
-
-
-# Compile Options
-#
-# -DEVAL_MINI      Ȃ̂mini(2֌W(KP+PP)̕]֐)
-# -DEVAL_NANO      Ȃ̂nano(2֌W(KP̂)̕]֐)
-# -DEVAL_APERY     nanopery(Apery̕]֐)
-#
-# -DTWIG           Apery(̎})̕]֐g
-# -DUSE_AVX2_EVAL  ]֐̌vZAVX߂g
-#
-# Visual C++IvV
-#
-# /D_CRT_SECURE_NO_WARNINGS
-#                   secureȊ֐gĂȂƂ̌xoȂ
-# /Zc:forScope      XR[v [vɕW C++ Kp
-# /Wall             xׂėLɂ
-# /GS[-]            ZLeB `FbNLɂ
-# /favor:<blend|AMD64|EM64T> œKvZbT
-# /GL[-]            ÑR[hs
-# /RTCs             X^bN t[ ^C `FbN
-# /RTCu             ĂȂ[Jϐ̃`FbN
-
-FLAGS = -DNDEBUG -D$(EVAL_TYPE) -DUSAPYON2 -DNANOHA -DCHK_PERFORM -DTWIG -DUSE_AVX2_EVAL\
-	-DOLD_LOCKS /favor:AMD64 /EHsc /D_CRT_SECURE_NO_WARNINGS \
-	 /GL /Zc:forScope
-#CXXFLAGS=$(FLAGS) /MT /W4 /Wall /nologo /Od /GS /RTCsu
-CXXFLAGS=$(FLAGS) /MD /W3 /nologo /Ox /Ob2 /GS- /Gm /Zi
-LDFLAGS=/NOLOGO /STACK:16777216,32768 /out:$(EXE) /LTCG /DEBUG
-PGOLDFLAGS1=/NOLOGO /STACK:16777216,32768 /out:$(EXE) /LTCG:PGI
-PGOLDFLAGS2=/NOLOGO /STACK:16777216,32768 /out:$(EXE) /LTCG:PGO
-
-
-all: $(EXE)
-
-$(EXE) : $(OBJS)
-	$(LD) $(LDFLAGS) $(OBJS) User32.lib
-
-.cpp.obj :
-	$(CC) $(CXXFLAGS) /c $*.cpp
-
-clean :
-	del /q *.obj
-	del /q *.idb
-	del /q *.pdb
-	del /q *.pgc
-	del /q *.pgd
-	del /q *.suo
-	del    $(PGOLOG)
-	del    $(EXE)
-
-pgo: $(OBJS)
-	$(LD) $(PGOLDFLAGS1) $(OBJS) User32.lib
-	$(EXE) bench 256 1 9
-	pgomgr /merge $(PGD)
-	pgomgr /summary $(PGD) > $(PGOLOG)
-	$(LD) $(PGOLDFLAGS2) $(OBJS) User32.lib
-
-prof-clean:
-	del /q *.pgc
-	del /q *.pgd
-	del    $(PGOLOG)
-	del    $(EXE)
@@ -22,9 +22,13 @@
   along with this program.  If not, see <http://www.gnu.org/licenses/>.
 */
 
+#include <algorithm>
+#include <chrono>
 #include <fstream>
+#include <iomanip>
 #include <iostream>
 #include <istream>
+#include <sstream>
 #include <vector>
 
 #include "misc.h"
@@ -33,6 +37,9 @@
 #include "thread.h"
 #include "uci.h"
 #include "evaluate.h"
+#ifdef NANOHA
+#include "dfpn.h"
+#endif
 
 
 using namespace std;
@@ -65,6 +72,26 @@ static const string EvalPos[] = {
 	"lkB4nl/8r/1sg5p/p1p2Bpp1/1Ps2p3/Pp4P1P/3s1PN2/KG1+p5/LN6L w GSN5Prg 1",
 	""
 };
+
+// lx`}[NFǖʁȀAl݂܂ł̎萔
+// (11ȏdf-pnŌ菇̒ŁAŒZƂ͌Ȃ)
+static const string TsumeProblems[] = {
+	"1n1s3n1/lk1gg1s2/3p1p1pl/pp1b2p2/BN1Pp2P1/PPr5p/K1S1SPP1R/L1+p4gL/4PG1N1 w 2p 1 7f7g+ 1",
+	"1rs4g1/5g1b1/3p1p+Pp1/lp1kp1rP1/plp1NP3/PnGPs4/1PP1G3P/2S1K1S1L/1+n2L2N1 w 2Pbp 1 3d3h+ 3",
+	"2s3ppk/1r3g2l/lppp1sPg1/3+bP3p/p3BpN2/PPPn1P+pP1/L1KP4N/1S2G2RL/1N3G1S1 b p 1 3c3b+ 3",
+	"ln2sks2/5r3/p3+N+Pn1l/g2p2Pgp/1ppP4P/3SP2p1/PPP2P1P1/LBS6/1NG1GR1KL b B2P 1 5c4b 5",
+	"1n1g3n1/ls1gk1s+Pl/r1b2P1+P1/ppp5P/3P4s/2P1ppPPS/+b1N2Gp1N/L4K1GL/5R3 w 3Pp 1 4f4g+ 5",
+	"3k5/P+Ps2+N3/2nrg2n1/1PpLg2Gl/p2P3sp/1KP1ppPbL/1p2SPp2/L8/2BG1+s+nPR b 2Pp 1 6d6c 5",
+	"p4p3/P1k1r1sPl/2p3b2/3p1P2p/1+B3gp2/lPP1R1Sp1/LgN1p1Pgn/1NG1P3L/S4S2K b 3Pn 1 5f5b+ 7",
+	"1n1r5/l1g2k2g/psp4B+P/5+BPp1/Gp5n+l/1PPSpPS2/P1RP1GNP1/L8/1N4K1L b S3P2p 1 2c3b+ 7",
+	"l1s1S4/r1k3s1l/1pnpp1+N1p/p1Pn2ppP/5+b1G1/bg1P3P1/PP2PP+r2/L7+l/1NSG1KG2 w 2Pp 1 4e6g 7",
+	"1k2s2n1/p6bl/3g+B1gpl/3p5/1p5SP/PPpPP1nP1/NSGR1+p2N/L1S1GRp1L/4K4 b 5P 1 5c6c 11",
+	"5gsnb/3k3pl/3r2p1p/lp1p2g2/3np1PP1/pPp3RSP/P1NPG1N1L/L2KP2+s1/5PG2 w 2Pbs 1 7f7g+ 15",
+	"2s1g1sr1/2g3k1l/2+S2p1Nn/lp1pP1pPp/p4PP2/1PP5+p/P1BPGKNR1/SB4G1L/L7N b 2Pp 1 7g3c+ 19",
+	"+P5s+P1/8l/+Bpg1kr2p/3p1Pg1P/P2s3G1/LNS1gppp1/n3+p1P1N/1B2+pRK1L/1N2S4 w 3Plp 1 5h4h 23",
+	"1n2k2nb/1g1b1s1+L1/lrpg2pp1/Ps1pp4/1PP2pP2/2L2P1Gp/+p1R+psS1PP/Lp2G4/KN5N1 w p 1 8h8i+ 29",
+	""
+};
 #endif
 
 #ifdef NANOHA
@@ -383,6 +410,192 @@ void bench_mate(int argc, char* argv[]) {
 	cerr << "Average =  " << conv_per_s(static_cast<const double>(loops*result.size()), time) << " times/s" << endl;
 }
 
+// lx`}[N
+// tsume [solver] [limit] [file] [json]
+//   solver : dfpn()Amate7(MateN())Amate3(Mate3())
+//   limit  : 1₠̏Bdfpn͎(msA1000)Amate7͋ǖʐ(100000)B
+//            łȂΏȗꂽ̂Ƃ file ƂĈ
+//   file   : 1s1 "[sfen] ǖ   萔 ̏ [l݂܂ł̎萔]"Bdefault Ȃgݍ݂̖
+//   json   : ʂJSONŏot@CBȗ͕Wo
+// 育ƂɃnbVĂ̂ŁALbV܂ĂȂԂ̐\𑪂B
+void bench_tsume(istream& is) {
+
+	struct Problem {
+		string sfen, answer;
+		int plies;
+	};
+	struct Result {
+		bool solved;
+		Move move;
+		int plies;
+		double msec;
+		uint64_t nodes;
+	};
+
+	string token;
+	string solver  = (is >> token) ? token : "dfpn";
+	int64_t limit  = solver == "dfpn" ? 1000 : 100000;
+	bool haveToken = bool(is >> token);
+	if (haveToken && token.find_first_not_of("0123456789") == string::npos) {
+		limit = stoll(token);
+		haveToken = bool(is >> token);
+	}
+	string fenFile = haveToken ? token : "default";
+	string jsonFile = (is >> token) ? token : "";
+
+	if (solver != "dfpn" && solver != "mate7" && solver != "mate3")
+	{
+		cerr << "Unknown solver " << solver << endl;
+		return;
+	}
+
+	vector<string> lines;
+	if (fenFile == "default") {
+		for (int i = 0; !TsumeProblems[i].empty(); i++)
+			lines.push_back(TsumeProblems[i]);
+	}
+	else {
+		ifstream f(fenFile);
+		if (!f.is_open())
+		{
+			cerr << "Unable to open file " << fenFile << endl;
+			return;
+		}
+		string line;
+		while (getline(f, line))
+			if (!line.empty())
+				lines.push_back(line);
+	}
+
+	vector<Problem> problems;
+	for (const string& line : lines) {
+		istringstream ls(line);
+		vector<string> f;
+		while (ls >> token)
+			f.push_back(token);
+		if (!f.empty() && f[0] == "sfen")
+			f.erase(f.begin());
+		if (f.size() < 4)
+			continue;
+		Problem p;
+		p.sfen = f[0] + " " + f[1] + " " + f[2] + " " + f[3];
+		p.answer = f.size() > 4 ? f[4] : "";
+		p.plies = f.size() > 5 ? stoi(f[5]) : 0;
+		problems.push_back(p);
+	}
+
+	cerr << "Tsume benchmark: " << solver << ", limit " << limit << ", " << problems.size() << " problems" << endl;
+
+	vector<Result> results;
+	uint64_t totalNodes = 0, probes = 0, hits = 0;
+	double totalMsec = 0;
+
+	for (size_t i = 0; i < problems.size(); i++)
+	{
+		Position pos(problems[i].sfen, Threads.main());
+		Result r = { false, MOVE_NONE, 0, 0.0, 0 };
+
+		MateSearch.clear();
+		clear_mate3_hash();
+		Thread* th = Threads.main();
+		const uint64_t called0 = th->mate3Called, hit0 = th->mate3HashHit;
+		pos.set_nodes_searched(0);
+		pos.set_tnodes_searched(0);
+
+		const auto start = std::chrono::steady_clock::now();
+		if (solver == "dfpn") {
+			vector<Move> pv;
+			r.solved = MateSearch.search(pos, pv, 0, limit, nullptr) == SearchMateDFPN::MATE;
+			r.move = r.solved ? pv[0] : MOVE_NONE;
+			r.plies = int(pv.size());
+			r.nodes = MateSearch.nodes_searched();
+			probes += MateSearch.hash_probes();
+			hits += MateSearch.hash_hits();
+		}
+		else {
+			int v;
+			if (solver == "mate7")
+				v = pos.MateN(pos.side_to_move(), 7, r.move, r.plies, limit);
+			else {
+				v = pos.Mate3(pos.side_to_move(), r.move);
+				r.plies = 3;
+			}
+			r.solved = (v == VALUE_MATE);
+			r.nodes = pos.nodes_searched() + pos.tnodes_searched();
+			probes += th->mate3Called - called0;
+			hits += th->mate3HashHit - hit0;
+		}
+		r.msec = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+		if (!r.solved) r.plies = 0;
+
+		totalNodes += r.nodes;
+		totalMsec += r.msec;
+		results.push_back(r);
+
+		cerr << i + 1 << '/' << problems.size() << "  " << (r.solved ? UCI::move(r.move) : "-")
+		     << " (" << (problems[i].answer.empty() ? "?" : problems[i].answer) << ")  "
+		     << r.plies << " plies  " << r.nodes << " nodes  " << r.msec << "(ms)" << endl;
+	}
+
+	// ̎Ԃ̕ς95p[Z^C
+	vector<double> times;
+	int matched = 0;
+	for (size_t i = 0; i < results.size(); i++) {
+		if (!results[i].solved)
+			continue;
+		times.push_back(results[i].msec);
+		if (UCI::move(results[i].move) == problems[i].answer)
+			matched++;
+	}
+	sort(times.begin(), times.end());
+	const size_t solved = times.size();
+	const double solveRate = problems.empty() ? 0.0 : double(solved) / problems.size();
+	double avgMsec = 0.0, p95Msec = 0.0;
+	if (solved > 0) {
+		for (double t : times)
+			avgMsec += t;
+		avgMsec /= solved;
+		p95Msec = times[(solved * 95 + 99) / 100 - 1];
+	}
+	const double nps = totalMsec > 0 ? totalNodes * 1000.0 / totalMsec : 0.0;
+	const double hitRate = probes > 0 ? double(hits) / probes : 0.0;
+
+	cerr << "\n==============================="
+	     << "\nSolved          : " << solved << '/' << problems.size() << " (" << solveRate * 100.0 << "%)"
+	     << "\nAnswer matched  : " << matched
+	     << "\nAverage (ms)    : " << avgMsec
+	     << "\n95%ile (ms)     : " << p95Msec
+	     << "\nNodes           : " << totalNodes
+	     << "\nNodes/second    : " << uint64_t(nps)
+	     << "\nHash hit (%)    : " << hitRate * 100.0 << endl;
+
+	ostringstream js;
+	js << setprecision(6)
+	   << "{\"solver\":\"" << solver << "\",\"limit\":" << limit
+	   << ",\"problems\":" << problems.size() << ",\"solved\":" << solved
+	   << ",\"solve_rate\":" << solveRate << ",\"answer_matched\":" << matched
+	   << ",\"avg_ms\":" << avgMsec << ",\"p95_ms\":" << p95Msec
+	   << ",\"nodes\":" << totalNodes << ",\"nps\":" << uint64_t(nps)
+	   << ",\"hash_hit_rate\":" << hitRate << ",\"results\":[";
+	for (size_t i = 0; i < results.size(); i++) {
+		const Result& r = results[i];
+		js << (i ? "," : "")
+		   << "{\"sfen\":\"" << problems[i].sfen << "\",\"answer\":\"" << problems[i].answer
+		   << "\",\"answer_plies\":" << problems[i].plies
+		   << ",\"solved\":" << (r.solved ? "true" : "false")
+		   << ",\"move\":\"" << (r.solved ? UCI::move(r.move) : "") << "\",\"plies\":" << r.plies
+		   << ",\"ms\":" << r.msec << ",\"nodes\":" << r.nodes << "}";
+	}
+	js << "]}";
+
+	if (jsonFile.empty())
+		sync_cout << js.str() << sync_endl;
+	else {
+		ofstream out(jsonFile);
+		out << js.str() << endl;
+	}
+}
+
 void bench_genmove(int argc, char* argv[]) {
 
 	vector<string> sfenList;
@@ -22,13 +22,40 @@
   along with this program.  If not, see <http://www.gnu.org/licenses/>.
 */
 
+#include <algorithm>
+#include <atomic>
 #include <cassert>
+#include <cctype>
+#include <climits>
+#include <cstdio>
+#include <fstream>
 #include <iostream>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#  define NOMINMAX // Disable macros min() and max()
+#endif
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#undef WIN32_LEAN_AND_MEAN
+#undef NOMINMAX
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 #include "misc.h"
 #include "book.h"
 #include "movegen.h"
 #include "position.h"
+#include "search.h"
+#include "thread.h"
+#include "tt.h"
+#include "uci.h"
 
 #ifdef USAPYON2
 Book *book[2];
@@ -36,39 +63,241 @@ Book *book[2];
 Book *book;
 #endif
 
-Book::Book() : joseki(), prng(now())
+namespace {
+	const char SortedMagic[8] = { 'U', 'S', 'P', 'S', 'B', 'K', '2', '\0' };
+
+	bool key_less(const BookRecord &r, const Key k) { return r.key < k; }
+	bool record_equal(const BookRecord &a, const BookRecord &b) { return !(a < b) && !(b < a); }
+
+	// t@C̑傫(t@CȂ -1)
+	int64_t file_size(const std::string& fileName)
+	{
+		std::ifstream ifs(fileName.c_str(), std::ios::binary | std::ios::ate);
+		return ifs ? int64_t(ifs.tellg()) : -1;
+	}
+}
+
+Book::Book() : records(NULL), count(0), mapped(NULL), mappedSize(0), owned(), prng(now())
 {
 }
-Book::~Book() {}
-void Book::open(const std::string& fileName)
+Book::~Book()
+{
+	close();
+}
+
+std::string Book::sorted_name(const std::string& fileName)
+{
+	const size_t dot = fileName.find_last_of('.');
+	const size_t sep = fileName.find_last_of("/\\");
+	if (dot == std::string::npos || (sep != std::string::npos && dot < sep)) return fileName + ".sbk";
+	return fileName.substr(0, dot) + ".sbk";
+}
+
+bool Book::read_jsk(const std::string& fileName, std::vector<BookRecord>& v)
 {
 	FILE *fp = fopen(fileName.c_str(), "rb");
 	if (fp == NULL) {
 		perror(fileName.c_str());
-		return;
+		return false;
 	}
 
-	BookKey key;
-	BookEntry data;
-
+	BookRecord r;
+	std::string sfen;
+	Position pos;
+	int bad = 0;
+	v.clear();
 	for (;;) {
 		size_t n;
-		n = fread(&key, sizeof(key), 1, fp);
+		n = fread(&r.huffman, sizeof(r.huffman), 1, fp);
 		if (n == 0) break;
-		n = fread(&data, sizeof(data), 1, fp);
+		n = fread(&r.data, sizeof(r.data), 1, fp);
 		if (n == 0) break;
-		Joseki_type::iterator p;
-		p = joseki.find(key);
-		if (p == joseki.end()) {
-			joseki.insert(Joseki_value(key, data));
-		} else {
-			output_info("Error!:Duplicated opening data\n");
+		// nt}ǖʂɖ߂ănbVL[߂
+		if (Position::DecodeHuffman(r.huffman.data, sfen) < 0) {
+			bad++;
+			continue;
 		}
+		pos.set(sfen, NULL);
+		r.key = pos.key();
+		v.push_back(r);
+	}
+	fclose(fp);
+	if (bad > 0) {
+		output_info("Error!:Huffman decode!(%d)\n", bad);
 	}
 
+	// ǖʂ͐ɏoĂ̂c
+	std::stable_sort(v.begin(), v.end());
+	const size_t n = v.size();
+	v.erase(std::unique(v.begin(), v.end(), record_equal), v.end());
+	if (v.size() != n) {
+		output_info("Error!:Duplicated opening data(%d)\n", int(n - v.size()));
+	}
+	return true;
+}
+
+bool Book::write_sorted(const std::string& fileName, const std::vector<BookRecord>& v, uint64_t sourceSize)
+{
+	BookFileHeader h;
+	memset(&h, 0, sizeof(h));
+	memcpy(h.magic, SortedMagic, sizeof(h.magic));
+	h.recordSize = sizeof(BookRecord);
+	h.count = v.size();
+	h.sourceSize = sourceSize;
+
+	FILE *fp = fopen(fileName.c_str(), "wb");
+	if (fp == NULL) return false;
+	bool ok = fwrite(&h, sizeof(h), 1, fp) == 1;
+	if (ok && !v.empty()) ok = fwrite(&v[0], sizeof(BookRecord), v.size(), fp) == v.size();
+	if (fclose(fp) != 0) ok = false;
+	if (!ok) remove(fileName.c_str());
+	return ok;
+}
+
+bool Book::read_sorted(const std::string& fileName, std::vector<BookRecord>& v, uint64_t& sourceSize)
+{
+	FILE *fp = fopen(fileName.c_str(), "rb");
+	if (fp == NULL) {
+		perror(fileName.c_str());
+		return false;
+	}
+	BookFileHeader h;
+	bool ok = fread(&h, sizeof(h), 1, fp) == 1
+	       && memcmp(h.magic, SortedMagic, sizeof(SortedMagic)) == 0
+	       && h.recordSize == sizeof(BookRecord);
+	if (ok) {
+		v.resize(size_t(h.count));
+		ok = v.empty() || fread(&v[0], sizeof(BookRecord), v.size(), fp) == v.size();
+		sourceSize = h.sourceSize;
+	}
 	fclose(fp);
+	if (!ok) {
+		output_info("Error!:Bad sorted book %s\n", fileName.c_str());
+	}
+	return ok;
+}
+
+bool Book::write_jsk(const std::string& fileName, const std::vector<BookRecord>& v)
+{
+	FILE *fp = fopen(fileName.c_str(), "wb");
+	if (fp == NULL) return false;
+	bool ok = true;
+	for (size_t i = 0; ok && i < v.size(); i++) {
+		ok = fwrite(&v[i].huffman, sizeof(v[i].huffman), 1, fp) == 1
+		  && fwrite(&v[i].data, sizeof(v[i].data), 1, fp) == 1;
+	}
+	if (fclose(fp) != 0) ok = false;
+	if (!ok) remove(fileName.c_str());
+	return ok;
+}
+
+// .sbk ǂݍݐpŃ}bv. sourceSize  0 ȏȂϊ̑傫ƈv̂g
+bool Book::map_sorted(const std::string& fileName, uint64_t sourceSize)
+{
+	void *addr = NULL;
+	size_t size = 0;
+#if defined(_WIN32)
+	HANDLE hFile = CreateFileA(fileName.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (hFile == INVALID_HANDLE_VALUE) return false;
+	LARGE_INTEGER fsize;
+	if (GetFileSizeEx(hFile, &fsize) && uint64_t(fsize.QuadPart) >= sizeof(BookFileHeader)) {
+		HANDLE hMap = CreateFileMappingA(hFile, NULL, PAGE_READONLY, 0, 0, NULL);
+		if (hMap != NULL) {
+			addr = MapViewOfFile(hMap, FILE_MAP_READ, 0, 0, 0);
+			size = size_t(fsize.QuadPart);
+			CloseHandle(hMap);	// r[Ԃ̓}bsO͎c
+		}
+	}
+	CloseHandle(hFile);
+#else
+	const int fd = ::open(fileName.c_str(), O_RDONLY);
+	if (fd < 0) return false;
+	struct stat st;
+	if (fstat(fd, &st) == 0 && size_t(st.st_size) >= sizeof(BookFileHeader)) {
+		addr = mmap(NULL, size_t(st.st_size), PROT_READ, MAP_SHARED, fd, 0);
+		if (addr == MAP_FAILED) addr = NULL;
+		size = size_t(st.st_size);
+	}
+	::close(fd);
+#endif
+	if (addr == NULL) return false;
+
+	const BookFileHeader *h = static_cast<const BookFileHeader*>(addr);
+	if (memcmp(h->magic, SortedMagic, sizeof(SortedMagic)) != 0
+	 || h->recordSize != sizeof(BookRecord)
+	 || h->count != (size - sizeof(BookFileHeader)) / sizeof(BookRecord)
+	 || (sourceSize != uint64_t(-1) && h->sourceSize != sourceSize)) {
+#if defined(_WIN32)
+		UnmapViewOfFile(addr);
+#else
+		munmap(addr, size);
+#endif
+		return false;
+	}
+
+	mapped = addr;
+	mappedSize = size;
+	records = reinterpret_cast<const BookRecord*>(h + 1);
+	count = size_t(h->count);
+	return true;
+}
+
+// fileName  .sbk Ȃ炻̂܂܃}bv. .jsk Ȃ瓯O .sbk TA
+// Ȃ(܂ .jsk ̑傫ςĂ)蒼Ă}bv.
+void Book::open(const std::string& fileName)
+{
+	close();
+
+	const std::string sbkName = sorted_name(fileName);
+	if (sbkName == fileName) {
+		if (!map_sorted(fileName, uint64_t(-1))) perror(fileName.c_str());
+		return;
+	}
+
+	const int64_t sourceSize = file_size(fileName);
+	if (map_sorted(sbkName, sourceSize < 0 ? uint64_t(-1) : uint64_t(sourceSize))) return;
+
+	if (!read_jsk(fileName, owned)) return;
+	if (write_sorted(sbkName, owned, uint64_t(sourceSize)) && map_sorted(sbkName, uint64_t(sourceSize))) {
+		std::vector<BookRecord>().swap(owned);
+		return;
+	}
+	// ߂ȂfBNgȂǂł̓̃f[^g
+	records = owned.empty() ? NULL : &owned[0];
+	count = owned.size();
+}
+
+void Book::close()
+{
+	if (mapped != NULL) {
+#if defined(_WIN32)
+		UnmapViewOfFile(mapped);
+#else
+		munmap(mapped, mappedSize);
+#endif
+	}
+	mapped = NULL;
+	mappedSize = 0;
+	std::vector<BookRecord>().swap(owned);
+	records = NULL;
+	count = 0;
+}
+
+// L[ɕ񂾒Ճf[^񕪒TAkey ȏ̍ŏ̃f[^Ԃ
+const BookRecord *Book::lower_bound(const Key key) const
+{
+	return std::lower_bound(records, records + count, key, key_less);
+}
+
+// nbVL[ key Ńnt} huffman ̒Ճf[^T
+const BookEntry *Book::find(const Key key, const BookKey &huffman) const
+{
+	const BookRecord *last = records + count;
+	for (const BookRecord *p = lower_bound(key); p != last && p->key == key; ++p) {
+		if (memcmp(p->huffman.data, huffman.data, sizeof(huffman.data)) == 0) return &p->data;
+	}
+	return NULL;
 }
-void Book::close(){}
 // Ճf[^A݂̋ǖk̍@肪̋ǖʂłǂꂭ炢̕pxŎwꂽԂB
 void Book::fromJoseki(Position &pos, int &mNum, MoveStack moves[], BookEntry data[])
 {
@@ -80,24 +309,33 @@ void Book::fromJoseki(Position &pos, int &mNum, MoveStack moves[], BookEntry dat
 
 	int i;
 	StateInfo newSt;
+	const BookRecord *end = records + count;
 	for (i = 0; i < mNum; i++) {
 		Move m = moves[i].move;
+		// nbVL[v肾ǖʂi߂ănt}ŏƍ
+		const Key k = pos.key_after(m);
+		const BookRecord *r = lower_bound(k);
+		if (r == end || r->key != k) {
+			// f[^Ȃ
+			data[i] = d_null;
+			continue;
+		}
 		pos.do_move(m, newSt);
 		int ret = pos.EncodeHuffman(key.data);
 		pos.undo_move(m);
 		if (ret < 0) {
 			pos.print_csa(m);
 			output_info("Error!:Huffman encode!\n");
+			data[i] = d_null;
 			continue;
 		}
-		Joseki_type::iterator p;
-		p = joseki.find(key);
-		if (p == joseki.end()) {
+		const BookEntry *p = find(k, key);
+		if (p == NULL) {
 			// f[^Ȃ
 			data[i] = d_null;
 		} else {
 			// f[^
-			data[i] = p->second;
+			data[i] = *p;
 		}
 	}
 }
@@ -114,11 +352,10 @@ int Book::getHindo(const Position &pos)
 		output_info("Error!:Huffman encode!\n");
 		return 0;
 	}
-	Joseki_type::iterator p;
-	p = joseki.find(key);
-	if (p != joseki.end()) {
+	const BookEntry *p = find(pos.key(), key);
+	if (p != NULL) {
 		// f[^
-		hindo = p->second.hindo;
+		hindo = p->hindo;
 	}
 
 	return hindo;
@@ -137,6 +374,23 @@ Move Book::get_move(Position& pos, bool findBestMove)
 		memset(candidate, 0, sizeof(candidate));
 
 		fromJoseki(pos, teNum, moves, hindo2);
+
+		// bookthink ŒT́A]lԂ悢 BookEvalMargin ȏ㈫ΑI΂Ȃ
+		const int margin = Options["BookEvalMargin"];
+		int eval_max = -VALUE_INFINITE;
+		for (i = 0; i < teNum; i++) {
+			if (hindo2[i].hindo > 0 && hindo2[i].depth > 0) {
+				const int e = (pos.side_to_move() == BLACK) ? hindo2[i].eval : -hindo2[i].eval;
+				eval_max = Max(eval_max, e);
+			}
+		}
+		for (i = 0; i < teNum; i++) {
+			if (hindo2[i].hindo > 0 && hindo2[i].depth > 0) {
+				const int e = (pos.side_to_move() == BLACK) ? hindo2[i].eval : -hindo2[i].eval;
+				if (e < eval_max - margin) hindo2[i].hindo = 0;
+			}
+		}
+
 		// ԏ̍IԁB
 		float swin = 0.5f;
 		float win_max = 0.0f;
@@ -215,3 +469,440 @@ Move Book::get_move(Position& pos, bool findBestMove)
 
 	return MOVE_NONE;
 }
+
+// makebook : (CSA/SFEN)Ղ
+//
+//  makebook [ply N] [min N] [depth N] [threads N] [out FILE] FILE|@LIST ...
+//
+//   FILE      .csa  CSA `̊(1t@C "/" ؂ŕǂĂ悢).
+//             ȊO1s1ǂ SFEN `
+//             ([position] startpos|sfen ... [moves ...] [resign|win]).
+//             resign ͎ԑ̕Awin ͎ԑ̏(錾)
+//   @LIST     t@C1s1t@C
+//   ply N     Jnǖʂ N ڂ܂ł̋ǖʂo^(l 40)
+//   min N     o N ̋ǖʂ͏oȂ(l 1)
+//   depth N   oǖʂ[ N ŒT eval ɓ(l 0 : TȂ)
+//   threads N ̍ĐƒTɎgXbh(l Threads)
+//   out FILE  ot@C(l book.sbk). .jsk Ȃ .jsk `ŏo
+namespace {
+	// 1Ǖ̊
+	struct GameRecord {
+		std::string sfen;				// Jnǖ
+		std::vector<std::string> moves;	// w(CSA ` USI `)
+		bool csa;
+		int winner;						// 0:s/, 1:菟, 2:菟
+	};
+
+	// Wv̋ǖ. L[̏ʃrbgŕāAXbhƂ̃bN̋炷
+	struct BookShard {
+		std::mutex mutex;
+		std::unordered_map<Key, BookRecord> records;
+	};
+	const int BookShardCount = 256;
+
+	std::string to_lower(std::string s)
+	{
+		std::transform(s.begin(), s.end(), s.begin(), [](unsigned char c) { return char(tolower(c)); });
+		return s;
+	}
+
+	bool has_suffix(const std::string& s, const std::string& suffix)
+	{
+		return s.size() >= suffix.size() && to_lower(s.substr(s.size() - suffix.size())) == suffix;
+	}
+
+	// CSA ̋(2) SFEN ̋ɕϊ. ͑啶A͏
+	std::string csa_piece_to_sfen(const std::string& name, const bool gote)
+	{
+		static const char *const CsaName[] = { "FU", "KY", "KE", "GI", "KI", "KA", "HI", "OU", "TO", "NY", "NK", "NG", "UM", "RY" };
+		static const char *const SfenName[] = { "P", "L", "N", "S", "G", "B", "R", "K", "+P", "+L", "+N", "+S", "+B", "+R" };
+		for (int i = 0; i < 14; i++) {
+			if (name == CsaName[i]) {
+				std::string s = SfenName[i];
+				if (gote) s = to_lower(s);
+				return s;
+			}
+		}
+		return "";
+	}
+
+	// CSA `̊1Ǔǂ. ǖ(PI, P1`P9, P+, P-)AԁAwAI(%XXX)
+	bool parse_csa(std::istream& is, GameRecord& g)
+	{
+		std::string board[10][10];	// [][i]  "+FU" Ȃǂ
+		int hand[2][7] = {{0}};		// (jp)
+		static const char *const HandName[] = { "FU", "KY", "KE", "GI", "KI", "KA", "HI" };
+		static const char HandSfen[] = "PLNSGBR";
+		bool sideWhite = false;
+		bool white = false;			// ݂̎
+		bool any = false;
+		std::string line;
+
+		g.moves.clear();
+		g.csa = true;
+		g.winner = 0;
+		while (std::getline(is, line)) {
+			std::istringstream ls(line);
+			std::string s;
+			while (std::getline(ls, s, ',')) {
+				while (!s.empty() && (s[s.size()-1] == '\r' || s[s.size()-1] == ' ')) s.erase(s.size()-1);
+				if (s.empty() || s[0] == '\'') continue;
+				if (s == "/") {
+					if (any) goto done;
+					continue;
+				}
+				any = true;
+				if (s.compare(0, 2, "PI") == 0) {
+					static const char *const Back = "KYKEGIKIOUKIGIKEKY";
+					for (int f = 1; f <= 9; f++) {
+						for (int r = 1; r <= 9; r++) board[f][r].clear();
+						board[f][1] = std::string("-") + std::string(Back + (f-1)*2, 2);
+						board[f][3] = "-FU";
+						board[f][7] = "+FU";
+						board[f][9] = std::string("+") + std::string(Back + (f-1)*2, 2);
+					}
+					board[8][2] = "-HI"; board[2][2] = "-KA";
+					board[2][8] = "+HI"; board[8][8] = "+KA";
+					// (PI82HI22KA Ȃ)
+					for (size_t i = 2; i + 4 <= s.size(); i += 4) {
+						board[s[i]-'0'][s[i+1]-'0'].clear();
+					}
+				} else if (s.size() >= 2 && s[0] == 'P' && s[1] >= '1' && s[1] <= '9') {
+					const int r = s[1] - '0';
+					for (int i = 0; i < 9; i++) {
+						const std::string cell = s.size() >= size_t(2 + 3*i + 3) ? s.substr(2 + 3*i, 3) : " * ";
+						board[9-i][r] = (cell[0] == '+' || cell[0] == '-') ? cell : "";
+					}
+				} else if (s.size() >= 2 && s[0] == 'P' && (s[1] == '+' || s[1] == '-')) {
+					const int c = (s[1] == '+') ? 0 : 1;
+					for (size_t i = 2; i + 4 <= s.size(); i += 4) {
+						const std::string sq = s.substr(i, 2), name = s.substr(i+2, 2);
+						if (sq == "00") {
+							for (int k = 0; k < 7; k++) if (name == HandName[k]) hand[c][k]++;
+						} else {
+							board[sq[0]-'0'][sq[1]-'0'] = std::string(1, s[1]) + name;
+						}
+					}
+				} else if (s == "+" || s == "-") {
+					sideWhite = white = (s == "-");
+				} else if ((s[0] == '+' || s[0] == '-') && s.size() >= 7) {
+					g.moves.push_back(s.substr(0, 7));
+					white = !white;
+				} else if (s[0] == '%') {
+					// ԑ̕
+					if (s == "%TORYO" || s == "%TIME_UP" || s == "%ILLEGAL_MOVE") g.winner = white ? 1 : 2;
+					// ԑ̏
+					else if (s == "%KACHI") g.winner = white ? 2 : 1;
+					else if (s == "%+ILLEGAL_ACTION") g.winner = 2;
+					else if (s == "%-ILLEGAL_ACTION") g.winner = 1;
+				}
+			}
+		}
+done:
+		if (!any) return false;
+
+		std::string sfen;
+		for (int r = 1; r <= 9; r++) {
+			int empty = 0;
+			for (int f = 9; f >= 1; f--) {
+				if (board[f][r].size() != 3) {
+					empty++;
+					continue;
+				}
+				if (empty) sfen += char('0' + empty);
+				empty = 0;
+				sfen += csa_piece_to_sfen(board[f][r].substr(1), board[f][r][0] == '-');
+			}
+			if (empty) sfen += char('0' + empty);
+			if (r < 9) sfen += '/';
+		}
+		sfen += sideWhite ? " w " : " b ";
+		const size_t handPos = sfen.size();
+		for (int c = 0; c < 2; c++) {
+			for (int k = 6; k >= 0; k--) {
+				if (hand[c][k] == 0) continue;
+				if (hand[c][k] > 1) sfen += std::to_string(hand[c][k]);
+				sfen += c == 0 ? HandSfen[k] : char(tolower(HandSfen[k]));
+			}
+		}
+		if (sfen.size() == handPos) sfen += '-';
+		g.sfen = sfen + " 1";
+		return true;
+	}
+
+	// SFEN `̊1sǂ
+	bool parse_sfen(const std::string& line, GameRecord& g)
+	{
+		std::istringstream is(line);
+		std::string token;
+
+		g.moves.clear();
+		g.csa = false;
+		g.winner = 0;
+		if (!(is >> token)) return false;
+		if (token == "position" && !(is >> token)) return false;
+		bool white = false;
+		if (token == "startpos") {
+			g.sfen = "lnsgkgsnl/1r5b1/ppppppppp/9/9/9/PPPPPPPPP/1B5R1/LNSGKGSNL b - 1";
+		} else if (token == "sfen") {
+			std::string f[4];
+			for (int i = 0; i < 4; i++) if (!(is >> f[i])) return false;
+			g.sfen = f[0] + " " + f[1] + " " + f[2] + " " + f[3];
+			white = (f[1] == "w");
+		} else {
+			return false;
+		}
+		while (is >> token) {
+			if (token == "moves") continue;
+			if (token == "resign") { g.winner = white ? 1 : 2; break; }
+			if (token == "win") { g.winner = white ? 2 : 1; break; }
+			g.moves.push_back(token);
+			white = !white;
+		}
+		return true;
+	}
+
+	// t@CɊJA1ǂԂ. ̃XbhĂ΂
+	class GameReader {
+		std::mutex mutex;
+		const std::vector<std::string>& files;
+		size_t next;
+		std::ifstream ifs;
+		bool csa;
+	public:
+		explicit GameReader(const std::vector<std::string>& f) : files(f), next(0), csa(false) {}
+		bool read(GameRecord& g)
+		{
+			std::lock_guard<std::mutex> lk(mutex);
+			for (;;) {
+				if (ifs.is_open()) {
+					if (csa) {
+						if (parse_csa(ifs, g)) return true;
+					} else {
+						std::string line;
+						while (std::getline(ifs, line)) {
+							if (parse_sfen(line, g)) return true;
+						}
+					}
+					ifs.close();
+				}
+				if (next >= files.size()) return false;
+				const std::string& name = files[next++];
+				ifs.clear();
+				ifs.open(name.c_str());
+				if (!ifs) {
+					perror(name.c_str());
+					continue;
+				}
+				csa = has_suffix(name, ".csa");
+			}
+		}
+	};
+
+	// ǖ pos ̏oWv
+	bool add_position(BookShard shards[], const Position& pos, const int winner, std::atomic<uint64_t>& collisions)
+	{
+		BookRecord r;
+		memset(&r, 0, sizeof(r));
+		if (pos.EncodeHuffman(r.huffman.data) < 0) return false;
+		r.key = pos.key();
+
+		BookShard& s = shards[r.key >> 56];
+		std::lock_guard<std::mutex> lk(s.mutex);
+		std::unordered_map<Key, BookRecord>::iterator p = s.records.find(r.key);
+		if (p == s.records.end()) {
+			p = s.records.insert(std::make_pair(r.key, r)).first;
+		} else if (memcmp(p->second.huffman.data, r.huffman.data, sizeof(r.huffman.data)) != 0) {
+			collisions++;
+			return false;
+		}
+		BookEntry& e = p->second.data;
+		if (e.hindo < USHRT_MAX) e.hindo++;
+		if (winner == 1 && e.swin < USHRT_MAX) e.swin++;
+		if (winner == 2 && e.gwin < USHRT_MAX) e.gwin++;
+		return true;
+	}
+
+	// ̎w@肩T
+	Move find_move(const Position& pos, const std::string& token, const bool csa)
+	{
+		for (MoveList<MV_LEGAL> ml(pos); !ml.end(); ++ml) {
+			if ((csa ? move_to_csa(ml.move()) : move_to_uci(ml.move())) == token) return ml.move();
+		}
+		return MOVE_NONE;
+	}
+
+	// o minHindo ȏ̋ǖʂ threads ̃XbhŒTA
+	// ]l(肩猩l)AőPA[. TǖʐԂ
+	size_t think_records(std::vector<BookRecord>& v, const int minHindo, const int depth, const int64_t nodes, const size_t threads)
+	{
+		std::atomic<size_t> next(0), done(0);
+		Search::think_init(depth * ONE_PLY);
+		run_book_threads(threads, [&](BookThread& th) {
+			std::string sfen;
+			Move best;
+			for (size_t i; (i = next++) < v.size(); ) {
+				BookEntry& e = v[i].data;
+				if (e.hindo < minHindo || Position::DecodeHuffman(v[i].huffman.data, sfen) < 0) continue;
+				Position pos(sfen, &th);
+				Value val = Search::think_position(th, pos, depth * ONE_PLY, nodes, best);
+				if (pos.side_to_move() != BLACK) val = -val;
+				e.eval = short(Max(-SHRT_MAX, Min(SHRT_MAX, int(val))));
+				e.bestMove = pack_move(best);
+				e.depth = (unsigned short)(th.completedDepth / ONE_PLY);
+				if (++done % 10000 == 0) {
+					output_info("info string %llu/%llu positions searched\n", (unsigned long long)done, (unsigned long long)v.size());
+				}
+			}
+		});
+		return done;
+	}
+
+	// Ճf[^o. .jsk Ȃ .jsk `ŁAȊO .sbk `ŏ.
+	// ՂƂĎgp(}bv)̃t@C󂳂Ȃ悤AʖŏĂu
+	bool write_book(const std::string& fileName, const std::vector<BookRecord>& v, const uint64_t sourceSize)
+	{
+		const std::string tmp = fileName + ".tmp";
+		if (!(has_suffix(fileName, ".jsk") ? Book::write_jsk(tmp, v) : Book::write_sorted(tmp, v, sourceSize))) return false;
+		remove(fileName.c_str());
+		if (rename(tmp.c_str(), fileName.c_str()) != 0) {
+			remove(tmp.c_str());
+			return false;
+		}
+		return true;
+	}
+}
+
+void make_book(std::istream& is)
+{
+	std::vector<std::string> files;
+	std::string token, out = "book.sbk";
+	int maxPly = 40, minHindo = 1, depth = 0;
+	size_t threads = Options["Threads"];
+
+	while (is >> token) {
+		if (token == "ply") is >> maxPly;
+		else if (token == "min") is >> minHindo;
+		else if (token == "depth") is >> depth;
+		else if (token == "threads") is >> threads;
+		else if (token == "out") is >> out;
+		else if (token[0] == '@') {
+			std::ifstream list(token.substr(1).c_str());
+			std::string name;
+			if (!list) perror(token.substr(1).c_str());
+			while (std::getline(list, name)) {
+				while (!name.empty() && (name[name.size()-1] == '\r' || name[name.size()-1] == ' ')) name.erase(name.size()-1);
+				if (!name.empty()) files.push_back(name);
+			}
+		} else files.push_back(token);
+	}
+	if (files.empty()) {
+		output_info("info string makebook [ply N] [min N] [depth N] [threads N] [out FILE] FILE|@LIST ...\n");
+		return;
+	}
+
+	// ɍĐċǖʂƂ̏oƏs𐔂
+	const TimePoint start = now();
+	std::vector<BookShard> shards(BookShardCount);
+	std::atomic<uint64_t> games(0), badGames(0), collisions(0);
+	GameReader reader(files);
+	run_book_threads(threads, [&](BookThread& th) {
+		GameRecord g;
+		while (reader.read(g)) {
+			std::vector<StateInfo> states(g.moves.size());
+			Position pos(g.sfen, &th);
+			add_position(&shards[0], pos, g.winner, collisions);
+			for (size_t i = 0; i < g.moves.size() && int(i) < maxPly; i++) {
+				const Move m = find_move(pos, g.moves[i], g.csa);
+				if (m == MOVE_NONE) {
+					badGames++;
+					break;
+				}
+				pos.do_move(m, states[i]);
+				add_position(&shards[0], pos, g.winner, collisions);
+			}
+			games++;
+		}
+	});
+
+	std::vector<BookRecord> v;
+	size_t positions = 0;
+	for (BookShard& s : shards) {
+		positions += s.records.size();
+		for (const auto& p : s.records) {
+			if (p.second.data.hindo >= minHindo) v.push_back(p.second);
+		}
+		std::unordered_map<Key, BookRecord>().swap(s.records);
+	}
+	std::sort(v.begin(), v.end());
+	output_info("info string makebook: %llu games (%llu bad), %llu positions, %llu collisions, %d ms\n",
+		(unsigned long long)games, (unsigned long long)badGames, (unsigned long long)positions,
+		(unsigned long long)collisions, int(now() - start));
+
+	// oǖʂTĕ]lƍőP
+	if (depth > 0) {
+		const size_t n = think_records(v, minHindo, depth, 0, threads);
+		output_info("info string makebook: searched %llu positions at depth %d, %d ms\n",
+			(unsigned long long)n, depth, int(now() - start));
+	}
+
+	const bool ok = write_book(out, v, 0);
+	if (!ok) perror(out.c_str());
+	output_info("info string makebook: wrote %llu positions to %s\n", (unsigned long long)(ok ? v.size() : 0), out.c_str());
+}
+
+// bookthink : Ղ̊eǖʂTA]lƍőPՂɏ
+//
+//  bookthink FILE [depth N] [nodes N] [min N] [threads N] [out FILE]
+//
+//   FILE      Ճt@C(.jsk  .sbk)
+//   depth N   T[(l 8. nodes w肵Ƃ͐Ȃ)
+//   nodes N   Tm[h̖ڈ([̊ȅIɒׂ)
+//   min N     o N ̋ǖʂ͒TȂ(l 1)
+//   threads N TɎgXbh(l Threads)
+//   out FILE  ot@C(l FILE ɑΉ .sbk)
+//
+//  ]l͐肩猩l. ՂIԂƂ(Book::get_move())ɁA]lԂ悢
+//  BookEvalMargin ȏ㈫͑I΂ȂȂ.
+void book_think(std::istream& is)
+{
+	std::string in, out, token;
+	int depth = 0, minHindo = 1;
+	int64_t nodes = 0;
+	size_t threads = Options["Threads"];
+
+	is >> in;
+	while (is >> token) {
+		if (token == "depth") is >> depth;
+		else if (token == "nodes") is >> nodes;
+		else if (token == "min") is >> minHindo;
+		else if (token == "threads") is >> threads;
+		else if (token == "out") is >> out;
+	}
+	if (in.empty()) {
+		output_info("info string bookthink FILE [depth N] [nodes N] [min N] [threads N] [out FILE]\n");
+		return;
+	}
+	if (depth <= 0) depth = nodes > 0 ? MAX_PLY - 1 : 8;
+	if (out.empty()) out = Book::sorted_name(in);
+
+	// .jsk  .sbk ́Aϊ̑傫cĂȂ Book::open() ō蒼Ă܂
+	const TimePoint start = now();
+	std::vector<BookRecord> v;
+	uint64_t sourceSize = 0;
+	if (Book::sorted_name(in) == in) {
+		if (!Book::read_sorted(in, v, sourceSize)) return;
+	} else {
+		if (!Book::read_jsk(in, v)) return;
+		const int64_t size = file_size(in);
+		sourceSize = size < 0 ? 0 : uint64_t(size);
+	}
+
+	const size_t n = think_records(v, minHindo, depth, nodes, threads);
+	output_info("info string bookthink: searched %llu of %llu positions, %d ms\n",
+		(unsigned long long)n, (unsigned long long)v.size(), int(now() - start));
+
+	const bool ok = write_book(out, v, sourceSize);
+	if (!ok) perror(out.c_str());
+	output_info("info string bookthink: wrote %llu positions to %s\n", (unsigned long long)(ok ? v.size() : 0), out.c_str());
+}
@@ -26,8 +26,9 @@
 #if !defined(BOOK_H_INCLUDED)
 #define BOOK_H_INCLUDED
 
-#include <map>
 #include <cstring>	// for memcmp()
+#include <string>
+#include <vector>
 
 #include "move.h"
 #include "misc.h"
@@ -46,23 +47,54 @@ struct BookKey {
 
 // Ճf[^̒g
 struct BookEntry {
-	short eval;				// ]l
+	short eval;				// ]l(肩猩l)
 	unsigned short hindo;	// px(o)
 	unsigned short swin;	// 菟
 	unsigned short gwin;	// 菟
-	unsigned short dummy[3];	// \
+	unsigned short bestMove;	// bookthink ŋ߂őP(pack_move() ̌`)
+	unsigned short depth;	// bookthink ŒT[(0 Ȃ eval, bestMove ͒Ťʂł͂Ȃ)
+	unsigned short dummy;	// \
 	unsigned char move[9][2];
 };
 
+// Ճf[^1. ǖʂ̃nbVL[ňAnt}œǖʂm߂
+//  (.jsk ̓nt} BookEntry ̑g񂳂ꂸɕ񂾂)
+struct BookRecord {
+	Key key;				// Position::key()(ՏAAԂ܂)
+	BookKey huffman;		// Position::EncodeHuffman() ̌
+	BookEntry data;
+
+	bool operator < (const BookRecord &b) const {
+		return key != b.key ? key < b.key : huffman < b.huffman;
+	}
+};
+
+// ςݒՃt@C(.sbk)̃wb_. ̌ɃL[ɕׂ BookRecord  count 
+struct BookFileHeader {
+	char magic[8];			// "USPSBK2\0"
+	uint32_t recordSize;	// sizeof(BookRecord)
+	uint32_t reserved0;
+	uint64_t count;			// BookRecord ̌
+	uint64_t sourceSize;	// ϊ .jsk ̑傫(.jsk XVꂽ蒼)
+	char reserved[32];
+};
+
 // Ղ̃NX
+//  .sbk ǂݍݐpŃɃ}bvA񕪒Tň.
+//  .sbk Ȃ .jsk (ȂƂ̓Ő񂵂Ďg).
 class Book {
 private:
-	typedef std::map<BookKey, BookEntry> Joseki_type;
-	typedef Joseki_type::value_type Joseki_value;
-	Joseki_type joseki;
+	const BookRecord *records;		// L[ɕ񂾒Ճf[^
+	size_t count;
+	void *mapped;					// }bv̈(wb_܂)
+	size_t mappedSize;
+	std::vector<BookRecord> owned;	// }bvłȂƂɓǂݍ񂾒Ճf[^
 	PRNG prng;
 	Book(const Book&);				// warning΍.
 	Book& operator = (const Book&);	// warning΍.
+	bool map_sorted(const std::string& fileName, uint64_t sourceSize);
+	const BookRecord *lower_bound(const Key key) const;
+	const BookEntry *find(const Key key, const BookKey &huffman) const;
 public:
 	Book();
 	~Book();
@@ -74,8 +106,19 @@ public:
 	// ݂̋ǖʂǂ̂炢̕pxŎwꂽՃf[^𒲂ׂ
 	int getHindo(const Position &pos);
 
+	// .jsk ǂŃL[ɕׂ(dL[͍ŏ̂̂c)
+	static bool read_jsk(const std::string& fileName, std::vector<BookRecord>& v);
+	// .sbk ǂ
+	static bool read_sorted(const std::string& fileName, std::vector<BookRecord>& v, uint64_t& sourceSize);
+	// L[ɕׂՃf[^ .sbk ɏo
+	static bool write_sorted(const std::string& fileName, const std::vector<BookRecord>& v, uint64_t sourceSize);
+	// Ճf[^ .jsk ɏo
+	static bool write_jsk(const std::string& fileName, const std::vector<BookRecord>& v);
+	// fileName ɑΉ .sbk ̃t@C
+	static std::string sorted_name(const std::string& fileName);
+
 	// 
-	size_t size() const {return joseki.size();}
+	size_t size() const {return count;}
 
 	Move get_move(Position& pos, bool findBestMove);
 };
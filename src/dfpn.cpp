@@ -0,0 +1,376 @@
+/*
+  Usapyon2, a USI shogi(japanese-chess) playing engine derived from 
+  Stockfish 7 & nanoha-mini 0.2.2.1
+  Stockfish, a UCI chess playing engine derived from Glaurung 2.1
+  Copyright (C) 2004-2008 Tord Romstad (Glaurung author)
+  Copyright (C) 2008-2015 Marco Costalba, Joona Kiiski, Tord Romstad  (Stockfish author)
+  Copyright (C) 2015-2016 Marco Costalba, Joona Kiiski, Gary Linscott, Tord Romstad  (Stockfish author)
+  Copyright (C) 2014-2016 Kazuyuki Kawabata (nanoha-mini author)
+  Copyright (C) 2015-2016 Yasuhiro Ike
+
+  Usapyon2 is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Usapyon2 is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <algorithm>
+#include <climits>
+#include <cstring>
+#include <iostream>
+
+#include "dfpn.h"
+#include "movegen.h"
+#include "position.h"
+
+SearchMateDFPN MateSearch;	// go mate Ŏg
+
+namespace {
+	const uint32_t INF = 100000000;		// ؖE̖ؐ
+	const int CacheLineSize = 64;
+
+	inline uint32_t add_number(uint32_t a, uint32_t b) {
+		return std::min(a + b, INF);
+	}
+}
+
+SearchMateDFPN::SearchMateDFPN()
+	: table(nullptr), mem(nullptr), mask(0), generation(0),
+	  moveBuf((MaxPly + 1) * MAX_MOVES), keyBuf((MaxPly + 1) * MAX_MOVES),
+	  nodes(0), hashProbes(0), hashHits(0), nodeLimit(0), startTime(0), timeLimit(0), stopSignal(nullptr), aborted(false)
+{
+}
+
+SearchMateDFPN::~SearchMateDFPN()
+{
+	free(mem);
+}
+
+// TCYMBP
+void SearchMateDFPN::resize(size_t mbSize)
+{
+	const size_t newCount = size_t(1) << msb((std::max(mbSize, size_t(1)) * 1024 * 1024) / sizeof(Entry));
+
+	if (table != nullptr && newCount == mask + 1)
+		return;
+
+	free(mem);
+	mem = calloc(newCount * sizeof(Entry) + CacheLineSize - 1, 1);
+	if (!mem)
+	{
+		std::cerr << "Failed to allocate " << mbSize
+		          << "MB for mate hash." << std::endl;
+		exit(EXIT_FAILURE);
+	}
+
+	table = (Entry*)((uintptr_t(mem) + CacheLineSize - 1) & ~(CacheLineSize - 1));
+	mask = newCount - 1;
+}
+
+void SearchMateDFPN::clear()
+{
+	if (table != nullptr)
+		std::memset(table, 0, (mask + 1) * sizeof(Entry));
+}
+
+const SearchMateDFPN::Entry* SearchMateDFPN::probe(const Key key) const
+{
+	const Entry* const cluster = &table[(size_t)key & mask & ~size_t(ClusterSize - 1)];
+	for (int i = 0; i < ClusterSize; i++) {
+		if (cluster[i].key == key) return &cluster[i];
+	}
+	return nullptr;
+}
+
+// key ̃GgԂBȂ΁AOȑO̒T̂́ATʂ̏Ȃ̂̏ɒu
+SearchMateDFPN::Entry* SearchMateDFPN::store(const Key key)
+{
+	Entry* const cluster = &table[(size_t)key & mask & ~size_t(ClusterSize - 1)];
+	Entry* replace = cluster;
+	for (int i = 0; i < ClusterSize; i++) {
+		if (cluster[i].key == key) {
+			cluster[i].generation = generation;
+			return &cluster[i];
+		}
+		if (cluster[i].key == 0) {
+			replace = &cluster[i];
+			break;
+		}
+		if ((replace->generation == generation) > (cluster[i].generation == generation)
+		 || ((replace->generation == generation) == (cluster[i].generation == generation) && cluster[i].work < replace->work)) {
+			replace = &cluster[i];
+		}
+	}
+	replace->key = key;
+	replace->pn = 1;
+	replace->dn = 1;
+	replace->move = MOVE_NONE;
+	replace->len = 0;
+	replace->pathDep = 0;
+	replace->generation = generation;
+	replace->work = 0;
+	return replace;
+}
+
+// qǖʂ̏ؖEؐB菇ɌꂽǖʂƐ[𒴂ǖʂ͕slƂĈ
+// ̕sl͍̎菇łȂ(GHI)̂ pathDep 𗧂ĂBnbVɂ pathDep 
+// sĺAT̒ł͎gAOȑO̒T͖̂̂TƂĈ
+void SearchMateDFPN::child_numbers(const Key key, int ply, uint32_t& pn, uint32_t& dn, int& len, bool& pathDep)
+{
+	len = 0;
+	pathDep = false;
+	if (ply >= MaxPly || std::find(path.begin(), path.end(), key) != path.end()) {
+		pn = INF;
+		dn = 0;
+		pathDep = true;
+		return;
+	}
+	const Entry* e = probe(key);
+	hashProbes++;
+	if (e != nullptr && !(e->pathDep && e->generation != generation)) {
+		hashHits++;
+		pn = e->pn;
+		dn = e->dn;
+		len = e->len;
+		pathDep = e->pathDep;
+	} else {
+		pn = 1;
+		dn = 1;
+	}
+}
+
+// ORߓ_(Uߕ)͉AANDߓ_(ʕ)͉A@Ȃ̂
+int SearchMateDFPN::gen_moves(Position& pos, bool orNode, MoveStack* mlist) const
+{
+	MoveStack* last;
+	if (orNode) {
+		bool bUchifudume = false;
+		last = (pos.side_to_move() == BLACK) ? pos.generate_check<BLACK>(mlist, bUchifudume)
+		                                     : pos.generate_check<WHITE>(mlist, bUchifudume);
+		if (last == nullptr) return 0;	// ʂȂ
+	} else {
+		last = generate<MV_EVASION>(pos, mlist);
+	}
+
+	int n = 0;
+	for (MoveStack* cur = mlist; cur != last; cur++) {
+		const Move m = cur->move;
+		// Uߕ̂킴킴ꂽs͓ǂ܂Ȃ(Mate3()Ɠ)
+		if (orNode && (m & MOVE_CHECK_NARAZU)) continue;
+		if (!pos.pl_move_is_legal(m)) continue;
+		mlist[n++].move = m;
+	}
+	return n;
+}
+
+bool SearchMateDFPN::check_abort()
+{
+	if (aborted) return true;
+
+	if (nodeLimit && nodes >= nodeLimit) {
+		aborted = true;
+	} else if ((nodes & 1023) == 0) {
+		if ((stopSignal != nullptr && stopSignal->load(std::memory_order_relaxed))
+		 || (timeLimit && now() - startTime >= timeLimit)) {
+			aborted = true;
+		}
+	}
+	return aborted;
+}
+
+// ǖ pos 臒l thpn, thdn ܂œWJ(Nagai  df-pn)
+// ORߓ_ł͎q̏ؖ̍ŏlؖA̘ؐaؐɂȂBANDߓ_͂̋tB
+template <bool OrNode>
+void SearchMateDFPN::mid(Position& pos, uint32_t thpn, uint32_t thdn, int ply)
+{
+	const Key key = pos.key();
+	const uint64_t startNodes = nodes++;
+	if (check_abort()) return;
+
+	if (OrNode) {
+		// 1l߂͂̏ŏؖ
+		Move m;
+		uint32_t info;
+		const int val = (pos.side_to_move() == BLACK) ? pos.Mate1ply<BLACK>(m, info)
+		                                              : pos.Mate1ply<WHITE>(m, info);
+		if (val == VALUE_MATE && pos.pl_move_is_legal(m)) {
+			Entry* e = store(key);
+			e->pn = 0;
+			e->dn = INF;
+			e->move = m;
+			e->len = 1;
+			e->pathDep = 0;
+			e->work = 1;
+			return;
+		}
+	}
+
+	MoveStack* const moves = &moveBuf[ply * MAX_MOVES];
+	Key* const keys = &keyBuf[ply * MAX_MOVES];
+	const int n = gen_moves(pos, OrNode, moves);
+	if (n == 0) {
+		// 肪Ȃ(sl)AłȂ(l)
+		Entry* e = store(key);
+		e->pn = OrNode ? INF : 0;
+		e->dn = OrNode ? 0 : INF;
+		e->move = MOVE_NONE;
+		e->len = 0;
+		e->pathDep = 0;
+		e->work = 1;
+		return;
+	}
+	for (int i = 0; i < n; i++) {
+		keys[i] = pos.key_after(moves[i].move);
+	}
+
+	path.push_back(key);
+	for (;;) {
+		// ORߓ_ł͎q̏ؖAANDߓ_ł͎q̔ؐŏ̎qI
+		uint32_t minN = INF + 1, secondN = INF, sumN = 0, bestOther = 0;
+		int best = 0, bestLen = INT_MAX, maxLen = 0;
+		bool anyPathDep = false, pathFreeDisproof = false;
+		for (int i = 0; i < n; i++) {
+			uint32_t cpn, cdn;
+			int clen;
+			bool cdep;
+			child_numbers(keys[i], ply + 1, cpn, cdn, clen, cdep);
+			if (cdn == 0) {
+				anyPathDep |= cdep;
+				pathFreeDisproof |= !cdep;
+			}
+			const uint32_t c = OrNode ? cpn : cdn;
+			const uint32_t o = OrNode ? cdn : cpn;
+			if (c < minN) {
+				secondN = std::min(secondN, minN);
+				minN = c;
+				best = i;
+				bestOther = o;
+				bestLen = clen;
+			} else {
+				secondN = std::min(secondN, c);
+				// l܂肪ΒZI
+				if (OrNode && c == 0 && clen < bestLen) {
+					best = i;
+					bestLen = clen;
+				}
+			}
+			sumN = add_number(sumN, o);
+			maxLen = std::max(maxLen, clen);
+		}
+
+		const uint32_t pn = OrNode ? minN : sumN;
+		const uint32_t dn = OrNode ? sumN : minN;
+		Entry* e = store(key);
+		e->pn = pn;
+		e->dn = dn;
+		e->move = moves[best].move;
+		e->len = uint16_t(pn != 0 ? 0 : OrNode ? bestLen + 1 : maxLen + 1);
+		// sĺAORߓ_ł͎q(ׂĕsl)̂ǂꂩAANDߓ_ł͕sl̎qׂ̂Ă
+		// 菇ɈˑĂΎ菇Ɉˑ
+		e->pathDep = dn == 0 && (OrNode ? anyPathDep : !pathFreeDisproof);
+		e->work = nodes - startNodes;
+
+		if (pn >= thpn || dn >= thdn || aborted) break;
+
+		// q臒lFŏI񂾑2Ԗڂ̒l+1܂ŁAȃ͑̎q̕c
+		const uint32_t thMin = OrNode ? thpn : thdn;
+		const uint32_t thSum = OrNode ? thdn : thpn;
+		const uint32_t childThMin = std::min(thMin, secondN + 1);
+		const uint32_t childThSum = thSum - sumN + bestOther;
+
+		const Move move = moves[best].move;
+		StateInfo st;
+		pos.do_move(move, st, 0);
+		if (OrNode) {
+			mid<false>(pos, childThMin, childThSum, ply + 1);
+		} else {
+			mid<true>(pos, childThSum, childThMin, ply + 1);
+		}
+		pos.undo_move(move);
+	}
+	path.pop_back();
+}
+
+// Uߕ̎Ԃ̋ǖ pos lނƂؖ(path ɂ pos ܂ł̎菇Ă邱)
+bool SearchMateDFPN::prove(Position& pos, int ply)
+{
+	const Entry* e = probe(pos.key());
+	if (e == nullptr || e->pn != 0) {
+		mid<true>(pos, INF - 1, INF - 1, ply);
+		e = probe(pos.key());
+	}
+	return e != nullptr && e->pn == 0;
+}
+
+// lݎ菇oBUߕ͍ŒZ̎Aʕ͍ŒɓI
+// nbVǖʂ͏ؖ
+bool SearchMateDFPN::extract_pv(Position& pos, std::vector<Move>& pv)
+{
+	StateInfo states[MaxPly];
+
+	path.clear();
+	for (int ply = 0; ply < MaxPly; ply++) {
+		Move m = MOVE_NONE;
+		if ((ply & 1) == 0) {
+			if (!prove(pos, ply)) return false;
+			m = probe(pos.key())->move;
+			if (m == MOVE_NONE || !pos.pl_move_is_legal(m)) return false;
+			path.push_back(pos.key());
+		} else {
+			MoveStack* const moves = &moveBuf[ply * MAX_MOVES];
+			const int n = gen_moves(pos, false, moves);
+			if (n == 0) return true;	// l
+
+			path.push_back(pos.key());
+			int maxLen = -1;
+			for (int i = 0; i < n; i++) {
+				StateInfo st;
+				pos.do_move(moves[i].move, st, 0);
+				const bool proven = prove(pos, ply + 1);
+				const int len = proven ? probe(pos.key())->len : 0;
+				pos.undo_move(moves[i].move);
+				if (!proven) return false;
+				if (len > maxLen) {
+					maxLen = len;
+					m = moves[i].move;
+				}
+			}
+		}
+		pv.push_back(m);
+		pos.do_move(m, states[ply], 0);
+	}
+	return false;
+}
+
+SearchMateDFPN::Result SearchMateDFPN::search(const Position& rootPos, std::vector<Move>& pv,
+                                              uint64_t nodeLim, TimePoint timeLim, const std::atomic_bool* stop)
+{
+	if (table == nullptr) resize(16);
+
+	Position pos(rootPos, rootPos.this_thread());
+	pv.clear();
+	path.clear();
+	nodes = 0;
+	hashProbes = hashHits = 0;
+	nodeLimit = nodeLim;
+	startTime = now();
+	timeLimit = timeLim;
+	stopSignal = stop;
+	aborted = false;
+	generation++;
+
+	if (!prove(pos, 0)) {
+		// 肩[ɂsĺA{ɕslǂ킩Ȃ
+		const Entry* e = probe(pos.key());
+		return !aborted && e != nullptr && e->dn == 0 && !e->pathDep ? NO_MATE : UNKNOWN;
+	}
+	return extract_pv(pos, pv) ? MATE : UNKNOWN;
+}
@@ -0,0 +1,107 @@
+/*
+  Usapyon2, a USI shogi(japanese-chess) playing engine derived from 
+  Stockfish 7 & nanoha-mini 0.2.2.1
+  Stockfish, a UCI chess playing engine derived from Glaurung 2.1
+  Copyright (C) 2004-2008 Tord Romstad (Glaurung author)
+  Copyright (C) 2008-2015 Marco Costalba, Joona Kiiski, Tord Romstad  (Stockfish author)
+  Copyright (C) 2015-2016 Marco Costalba, Joona Kiiski, Gary Linscott, Tord Romstad  (Stockfish author)
+  Copyright (C) 2014-2016 Kazuyuki Kawabata (nanoha-mini author)
+  Copyright (C) 2015-2016 Yasuhiro Ike
+
+  Usapyon2 is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Usapyon2 is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#if !defined(DFPN_H_INCLUDED)
+#define DFPN_H_INCLUDED
+
+#include <atomic>
+#include <vector>
+
+#include "misc.h"
+#include "move.h"
+
+class Position;
+
+// df-pn(depth-first proof-number search)ɂlT
+// ؖEؐ͐p̃nbVɒuAu\(TT)Ƃ͋LȂB
+// 1̃CX^X𓯎Ɏĝ1XbhB
+class SearchMateDFPN {
+public:
+	enum Result {
+		MATE,		// l(pv ɋlݎ菇)
+		NO_MATE,	// sl
+		UNKNOWN		// m[hEԂ̐ stop őł؂
+	};
+
+	SearchMateDFPN();
+	~SearchMateDFPN();
+	// TCYMBP
+	void resize(size_t mbSize);
+	void clear();
+
+	// pos ̎ԑʂl܂邩ׂB
+	// nodeLimit  0 Ȃm[hAtimeLimit(ms)  0 Ȃ玞Ԃ̐ȂB
+	// stop  true ɂȂł؂B
+	Result search(const Position& pos, std::vector<Move>& pv,
+	              uint64_t nodeLimit, TimePoint timeLimit, const std::atomic_bool* stop = nullptr);
+	uint64_t nodes_searched() const { return nodes; }
+	// O search() ŃnbV񐔂ƁÂ
+	uint64_t hash_probes() const { return hashProbes; }
+	uint64_t hash_hits() const { return hashHits; }
+
+private:
+	SearchMateDFPN(const SearchMateDFPN&);				// warning΍.
+	SearchMateDFPN& operator = (const SearchMateDFPN&);	// warning΍.
+
+	struct Entry {
+		Key key;
+		uint32_t pn, dn;	// ؖAؐ
+		Move move;			// ؖ()Ɏg
+		uint16_t len : 15;	// ؖς݂̂ƂAl݂܂ł̎萔
+		uint16_t pathDep : 1;	// 肩[ɂslŁA菇ɂĂ͐Ȃ
+		uint16_t generation;
+		uint64_t work;		// ̋ǖʂ̒TɎgm[h(u̗Dx)
+	};
+	static const int ClusterSize = 4;
+	static const int MaxPly = 256;
+
+	template <bool OrNode> void mid(Position& pos, uint32_t thpn, uint32_t thdn, int ply);
+	int gen_moves(Position& pos, bool orNode, MoveStack* mlist) const;
+	void child_numbers(const Key key, int ply, uint32_t& pn, uint32_t& dn, int& len, bool& pathDep);
+	const Entry* probe(const Key key) const;
+	Entry* store(const Key key);
+	bool prove(Position& pos, int ply);
+	bool extract_pv(Position& pos, std::vector<Move>& pv);
+	bool check_abort();
+
+	Entry* table;
+	void* mem;
+	size_t mask;
+	uint16_t generation;
+
+	std::vector<MoveStack> moveBuf;		// [Ƃ̎w
+	std::vector<Key> keyBuf;			// moveBuf ̎w̋ǖʂ̃L[
+	std::vector<Key> path;				// T̎菇̋ǖ(̌op)
+
+	uint64_t nodes;
+	uint64_t hashProbes, hashHits;
+	uint64_t nodeLimit;
+	TimePoint startTime, timeLimit;
+	const std::atomic_bool* stopSignal;
+	bool aborted;
+};
+
+extern SearchMateDFPN MateSearch;
+
+#endif // !defined(DFPN_H_INCLUDED)
@@ -36,6 +36,9 @@ Value evaluate(const Position& pos, Value& margin);
 #else
 namespace Eval {
 	const Value Tempo = Value(20); // Must be visible to search
+#if defined(EVAL_APERY) && defined(TWIG)
+	void resize_hash(size_t mbSize);	// ]l̃nbV(ehash)̃TCY(MB)ݒ肷
+#endif
 }
 #if defined(NANOHA) && (USE_AVX2_EVAL) && (TWIG)
 #include <emmintrin.h>
@@ -27,18 +27,60 @@
 
 #include <cassert>
 #include <cstdio>
+#include <cstring>
+#include <algorithm>
 #include <array>
+#include <vector>
 #include <iostream>
 #include <fstream>
 
+#include "misc.h"
 #include "position.h"
 #include "evaluate.h"
 
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#include <immintrin.h>
+#endif
+#if defined(EVAL_MMAP) && defined(_WIN32)
+#ifndef NOMINMAX
+#  define NOMINMAX // Disable macros min() and max()
+#endif
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#undef WIN32_LEAN_AND_MEAN
+#undef NOMINMAX
+#elif defined(EVAL_MMAP)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// KPP ̌vZ SSE4.1/AVX2/AVX-512 ̃J[lpӂAs CPU Đ؂ւB
+// gcc/clang ł̓RpCIvVŋĂȂ߂͊֐Ƃ target w肷B
+#if defined(__GNUC__)
+#define TARGET_SSE41	__attribute__((target("sse4.1")))
+#define TARGET_AVX2 	__attribute__((target("avx2")))
+#define TARGET_AVX512	__attribute__((target("avx512f")))
+#else
+#define TARGET_SSE41
+#define TARGET_AVX2
+#define TARGET_AVX512
+#endif
+#if (defined(_MSC_VER) && _MSC_VER >= 1911) || (defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 7) || (defined(__clang__) && __clang_major__ >= 4)
+#define HAVE_AVX512_INTRIN
+#endif
+
 // ]֐֘A`
 #include "param_apery.h"
 #define FV_KK_BIN  "KK_synthesized.bin"
 #define FV_KKP_BIN "KKP_synthesized.bin"
 #define FV_KPP_BIN "KPP_synthesized.bin"
+#define FV_KKP_COMPACT_BIN "KKP_compact.bin"
+#define FV_KPP_COMPACT_BIN "KPP_compact.bin"
 
 #define HANDLIST	14
 #define NLIST	(38)
@@ -82,8 +124,25 @@ enum { nhand = 7, nfile = 9,  nrank = 9,  nsquare = 81 };
 // ]֐e[ũItZbgB
 // f_xxx ̋Ae_xxx G̋
 // Bonanza ̉eŎ 0 ̏ꍇ̃CfbNX݂邪AQƂ鎖͖B
-// todo:  0 ̈ʒul߂ăe[ułB(LbVɏ͏₷?)
+// EVAL_COMPACT ̂Ƃ͎ 0 ̈ʒul߂( n  f_hand_xxx + n ŁAn >= 1)B
 enum {
+#if defined(EVAL_COMPACT)
+	f_hand_pawn   = -1,
+	e_hand_pawn   = f_hand_pawn   + 18,
+	f_hand_lance  = e_hand_pawn   + 18,
+	e_hand_lance  = f_hand_lance  +  4,
+	f_hand_knight = e_hand_lance  +  4,
+	e_hand_knight = f_hand_knight +  4,
+	f_hand_silver = e_hand_knight +  4,
+	e_hand_silver = f_hand_silver +  4,
+	f_hand_gold   = e_hand_silver +  4,
+	e_hand_gold   = f_hand_gold   +  4,
+	f_hand_bishop = e_hand_gold   +  4,
+	e_hand_bishop = f_hand_bishop +  2,
+	f_hand_rook   = e_hand_bishop +  2,
+	e_hand_rook   = f_hand_rook   +  2,
+	fe_hand_end   = e_hand_rook   +  3,
+#else
 	f_hand_pawn   = 0, // 0
 	e_hand_pawn   = f_hand_pawn   + 19,
 	f_hand_lance  = e_hand_pawn   + 19,
@@ -99,6 +158,7 @@ enum {
 	f_hand_rook   = e_hand_bishop +  3,
 	e_hand_rook   = f_hand_rook   +  3,
 	fe_hand_end   = e_hand_rook   +  3,
+#endif
 
 	f_pawn        = fe_hand_end,
 	e_pawn        = f_pawn        + 81,
@@ -131,9 +191,136 @@ namespace {
 	int fv_kkp[nsquare][nsquare][fe_end];
 	int fv_kk[nsquare][nsquare];
 #else
-	static std::array<short, 2> KPP[nsquare][fe_end][fe_end];
-	static std::array<int, 2> KKP[nsquare][nsquare][fe_end];
-	static std::array<int, 2> KK[nsquare][nsquare];
+	// init_evaluate() Ń}bvt@C(EVAL_MMAP)Aǂݍ񂾗̈w
+#if defined(EVAL_COMPACT)
+	// KPP[sq][i][j]  KPP[sq][j][i] ͓lȂ̂ŁAi > j ̕Op`ɋl߂Ď
+	enum { kpp_tri_end = fe_end * (fe_end - 1) / 2 };
+	static const std::array<short, 2> (*KPP)[kpp_tri_end];
+#else
+	static const std::array<short, 2> (*KPP)[fe_end][fe_end];
+#endif
+	static const std::array<int, 2> (*KKP)[nsquare][fe_end];
+	static const std::array<int, 2> (*KK)[nsquare];
+
+	// KPP[sq]  k sڂ𓾂BEVAL_COMPACT ̂Ƃ k 菬񂵂Ȃ
+#if defined(EVAL_COMPACT)
+	typedef const std::array<short, 2>* KPPRows;
+	inline const std::array<short, 2>* kpp_row(KPPRows ppkpp, const int k) { return ppkpp + k * (k - 1) / 2; }
+	inline const std::array<short, 2>& kpp_at(KPPRows ppkpp, const int k, const int l) {
+		return k > l ? kpp_row(ppkpp, k)[l] : kpp_row(ppkpp, l)[k];
+	}
+#else
+	typedef const std::array<short, 2> (*KPPRows)[fe_end];
+	inline const std::array<short, 2>* kpp_row(KPPRows ppkpp, const int k) { return ppkpp[k]; }
+	inline const std::array<short, 2>& kpp_at(KPPRows ppkpp, const int k, const int l) { return ppkpp[k][l]; }
+#endif
+#endif
+
+	// ]֐̃t@CǂݍށB傫 size oCgłȂ nullptr ԂB
+	// EVAL_MMAP ̂Ƃ̓t@CǂݍݐpŃɃ}bvB}Vœ
+	// ̃vZX̓y[WLbV̓y[WQƂ̂ŕ1ōς݁A
+	// NɃt@CŜǂޕKvȂB
+	const void* load_table(const char* fname, const size_t size)
+	{
+#if defined(EVAL_MMAP) && defined(_WIN32)
+		// t@CwɎr[ɂ̓[Wy[W͎gȂ
+		HANDLE hFile = CreateFileA(fname, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+		if (hFile != INVALID_HANDLE_VALUE) {
+			const void* addr = nullptr;
+			LARGE_INTEGER fsize;
+			if (GetFileSizeEx(hFile, &fsize) && uint64_t(fsize.QuadPart) == size) {
+				HANDLE hMap = CreateFileMappingA(hFile, NULL, PAGE_READONLY, 0, 0, NULL);
+				if (hMap != NULL) {
+					addr = MapViewOfFile(hMap, FILE_MAP_READ, 0, 0, 0);
+					CloseHandle(hMap);	// r[Ԃ̓}bsO͎c
+				}
+			}
+			CloseHandle(hFile);
+			if (addr)
+				return addr;
+		}
+#elif defined(EVAL_MMAP)
+		const int fd = open(fname, O_RDONLY);
+		if (fd >= 0) {
+			void* addr = MAP_FAILED;
+			struct stat st;
+			if (fstat(fd, &st) == 0 && size_t(st.st_size) == size)
+				addr = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+			close(fd);
+			if (addr != MAP_FAILED) {
+#if defined(MADV_HUGEPAGE)
+				// J[lΉĂ΃y[WLbVq[Wy[WŎ
+				madvise(addr, size, MADV_HUGEPAGE);
+#endif
+				return addr;
+			}
+		}
+#endif
+		// }bvłȂƂ͕ʂɓǂݍ
+		std::ifstream ifs(fname, std::ios::binary);
+		if (!ifs)
+			return nullptr;
+		char* buf = new char[size];
+		if (!ifs.read(buf, size) || ifs.peek() != EOF) {
+			delete[] buf;
+			return nullptr;
+		}
+		return buf;
+	}
+
+#if defined(EVAL_COMPACT) && defined(TWIG)
+	// *_synthesized.bin  EVAL_COMPACT ̌`̃t@C
+	enum { fe_end_synthesized = fe_end + 14 };
+
+	// l߂CfbNX *_synthesized.bin ł̃CfbNX߂
+	int synthesized_index(const int c)
+	{
+		static const int handMax[] = { 18, 18, 4, 4, 4, 4, 4, 4, 4, 4, 2, 2, 2, 2 };
+		int k = c;
+		int base = 0;
+		for (const int h : handMax) {
+			if (k < h) return base + 1 + k;
+			k -= h;
+			base += h + 1;
+		}
+		return base + k;	// Տ͎̋ 0 ̕邾
+	}
+
+	bool convert_to_compact()
+	{
+		std::ifstream ifsKKP(FV_KKP_BIN, std::ios::binary);
+		std::ifstream ifsKPP(FV_KPP_BIN, std::ios::binary);
+		std::ofstream ofsKKP(FV_KKP_COMPACT_BIN, std::ios::binary);
+		std::ofstream ofsKPP(FV_KPP_COMPACT_BIN, std::ios::binary);
+		if (!ifsKKP || !ifsKPP || !ofsKKP || !ofsKPP)
+			return false;
+
+		int index[fe_end];
+		for (int c = 0; c < fe_end; ++c)
+			index[c] = synthesized_index(c);
+
+		// ʂ̈ʒuƂɕϊ
+		std::vector<std::array<int, 2>> kkpIn(fe_end_synthesized), kkpOut(fe_end);
+		for (int sq = 0; sq < nsquare * nsquare; ++sq) {
+			if (!ifsKKP.read(reinterpret_cast<char*>(kkpIn.data()), kkpIn.size() * sizeof(kkpIn[0])))
+				return false;
+			for (int c = 0; c < fe_end; ++c)
+				kkpOut[c] = kkpIn[index[c]];
+			ofsKKP.write(reinterpret_cast<const char*>(kkpOut.data()), kkpOut.size() * sizeof(kkpOut[0]));
+		}
+
+		std::vector<std::array<short, 2>> kppIn(size_t(fe_end_synthesized) * fe_end_synthesized), kppOut(kpp_tri_end);
+		for (int sq = 0; sq < nsquare; ++sq) {
+			if (!ifsKPP.read(reinterpret_cast<char*>(kppIn.data()), kppIn.size() * sizeof(kppIn[0])))
+				return false;
+			for (int i = 1; i < fe_end; ++i)
+				for (int j = 0; j < i; ++j)
+					kppOut[i * (i - 1) / 2 + j] = kppIn[size_t(index[i]) * fe_end_synthesized + index[j]];
+			ofsKPP.write(reinterpret_cast<const char*>(kppOut.data()), kppOut.size() * sizeof(kppOut[0]));
+		}
+
+		return bool(ofsKKP.flush()) && bool(ofsKPP.flush());
+	}
 #endif
 }
 
@@ -238,6 +425,72 @@ struct EvalSum {
 #endif
 	};
 };
+
+// ]l̃nbV(ehash)
+// Gg EvalSum  encode() ԂŊi[BǂݏoGg decode() 
+// key v΃f[^vĂ̂ŁAXbhԂ lock ͎ȂB
+class EvaluateHashTable {
+public:
+	~EvaluateHashTable() { free(mem); }
+	void resize(size_t mbSize);
+
+	bool probe(const Key key, EvalSum& sum) const {
+		if (table == nullptr) return false;
+		EvalSum entry(table[key & mask]);
+		entry.decode();
+		if (entry.key != key) return false;
+		sum = entry;
+		return true;
+	}
+	void store(const Key key, const EvalSum& sum) {
+		if (table == nullptr) return;
+		EvalSum entry(sum);
+		entry.key = key;
+		entry.encode();
+		table[key & mask] = entry;
+	}
+
+private:
+	static const int CacheLineSize = 64;
+	size_t mask = 0;
+	EvalSum* table = nullptr;
+	void* mem = nullptr;
+};
+
+namespace {
+	EvaluateHashTable EHash;	// SXbhŋL
+}
+
+// TCYMBPʁB0 ̂Ƃ ehash gȂ
+void EvaluateHashTable::resize(size_t mbSize) {
+
+	const size_t newCount = mbSize ? size_t(1) << msb((mbSize * 1024 * 1024) / sizeof(EvalSum)) : 0;
+
+	if (newCount == (table ? mask + 1 : 0))
+		return;
+
+	free(mem);
+	mem = nullptr;
+	table = nullptr;
+	mask = 0;
+	if (newCount == 0)
+		return;
+
+	mem = calloc(newCount * sizeof(EvalSum) + CacheLineSize - 1, 1);
+	if (!mem)
+	{
+		std::cerr << "Failed to allocate " << mbSize
+		          << "MB for evaluation hash." << std::endl;
+		exit(EXIT_FAILURE);
+	}
+
+	table = (EvalSum*)((uintptr_t(mem) + CacheLineSize - 1) & ~(CacheLineSize - 1));
+	mask = newCount - 1;
+}
+
+void Eval::resize_hash(size_t mbSize) {
+	EHash.resize(mbSize);
+}
 #endif
 
 namespace NanohaTbl {
@@ -259,24 +512,35 @@ namespace NanohaTbl {
 void Position::init_evaluate()
 {
 	int iret=0;
-	FILE *fp;
 	const char *fname ="]xNg";
 
 	do {
 		// KK
-		std::ifstream ifsKK("KK_synthesized.bin", std::ios::binary);
-		if (ifsKK) ifsKK.read(reinterpret_cast<char*>(KK), sizeof(KK));
-		else { iret=-1; fname="KK_synthesized.bin"; continue;}
+		KK = static_cast<const std::array<int, 2> (*)[nsquare]>(load_table(FV_KK_BIN, sizeof(std::array<int, 2>[nsquare][nsquare])));
+		if (!KK) { iret=-1; fname=FV_KK_BIN; continue;}
 
+#if defined(EVAL_COMPACT) && defined(TWIG)
+		// l߂`̃t@C *_synthesized.bin 
+		const size_t kkpSize = sizeof(std::array<int, 2>[nsquare][nsquare][fe_end]);
+		const size_t kppSize = sizeof(std::array<short, 2>[nsquare][kpp_tri_end]);
+		KKP = static_cast<const std::array<int, 2> (*)[nsquare][fe_end]>(load_table(FV_KKP_COMPACT_BIN, kkpSize));
+		KPP = static_cast<const std::array<short, 2> (*)[kpp_tri_end]>(load_table(FV_KPP_COMPACT_BIN, kppSize));
+		if (!KKP || !KPP) {
+			if (!convert_to_compact()) { iret=-1; fname=FV_KPP_COMPACT_BIN; continue;}
+			KKP = static_cast<const std::array<int, 2> (*)[nsquare][fe_end]>(load_table(FV_KKP_COMPACT_BIN, kkpSize));
+			KPP = static_cast<const std::array<short, 2> (*)[kpp_tri_end]>(load_table(FV_KPP_COMPACT_BIN, kppSize));
+		}
+		if (!KKP) { iret=-1; fname=FV_KKP_COMPACT_BIN; continue;}
+		if (!KPP) { iret=-1; fname=FV_KPP_COMPACT_BIN; continue;}
+#else
 		// KKP
-		std::ifstream ifsKKP("KKP_synthesized.bin", std::ios::binary);
-		if (ifsKKP) ifsKKP.read(reinterpret_cast<char*>(KKP), sizeof(KKP));
-		else { iret=-1; fname="KKP_synthesized.bin"; continue;}
+		KKP = static_cast<const std::array<int, 2> (*)[nsquare][fe_end]>(load_table(FV_KKP_BIN, sizeof(std::array<int, 2>[nsquare][nsquare][fe_end])));
+		if (!KKP) { iret=-1; fname=FV_KKP_BIN; continue;}
 
 		// KPP
-		std::ifstream ifsKPP("KPP_synthesized.bin", std::ios::binary);
-		if (ifsKPP) ifsKPP.read(reinterpret_cast<char*>(KPP), sizeof(KPP));
-		else { iret=-1; fname="KPP_synthesized.bin"; continue;}
+		KPP = static_cast<const std::array<short, 2> (*)[fe_end][fe_end]>(load_table(FV_KPP_BIN, sizeof(std::array<short, 2>[nsquare][fe_end][fe_end])));
+		if (!KPP) { iret=-1; fname=FV_KPP_BIN; continue;}
+#endif
 	} while (0);
 
 	if (iret < 0) {
@@ -402,10 +666,9 @@ int Position::compute_material() const
 	return v;
 }
 
-//int Position::make_list_apery(int list0[NLIST], int list1[NLIST], int nlist) const
-int Position::make_list_apery(int list0[], int list1[], int nlist) const
-{
-	static const struct {
+namespace {
+	// Տ̋̕]֐e[ũItZbg []
+	const struct {
 		int f_pt, e_pt;
 	} base_tbl[] = {
 		{-1      , -1      },	//  0:---
@@ -441,6 +704,352 @@ int Position::make_list_apery(int list0[], int list1[], int nlist) const
 		{e_horse , f_horse },	// 30:GUM
 		{e_dragon, f_dragon}	// 31:GRY
 	};
+
+	// ̕]֐e[ũItZbg []
+	// ̎猩́B̎ f_pt  e_pt ւĎg
+	const struct {
+		int f_pt, e_pt;
+	} hand_base_tbl[] = {
+		{-1           , -1           },	// 0:---
+		{f_hand_pawn  , e_hand_pawn  },	// 1:FU
+		{f_hand_lance , e_hand_lance },	// 2:KY
+		{f_hand_knight, e_hand_knight},	// 3:KE
+		{f_hand_silver, e_hand_silver},	// 4:GI
+		{f_hand_gold  , e_hand_gold  },	// 5:KI
+		{f_hand_bishop, e_hand_bishop},	// 6:KA
+		{f_hand_rook  , e_hand_rook  },	// 7:HI
+	};
+
+	// Xg
+	int make_hand_list(const uint32_t handB, const uint32_t handW, int list0[], int list1[])
+	{
+		int nlist = 0;
+#define FOO(hand, Piece, list0_index, list1_index)    \
+	for (int i = I2Hand##Piece(hand); i >= 1; --i) {  \
+		list0[nlist] = list0_index + i;               \
+		list1[nlist] = list1_index + i;               \
+		++nlist; \
+	}
+
+		FOO(handB, Pawn  , f_hand_pawn  , e_hand_pawn  )
+		FOO(handW, Pawn  , e_hand_pawn  , f_hand_pawn  )
+		FOO(handB, Lance , f_hand_lance , e_hand_lance )
+		FOO(handW, Lance , e_hand_lance , f_hand_lance )
+		FOO(handB, Knight, f_hand_knight, e_hand_knight)
+		FOO(handW, Knight, e_hand_knight, f_hand_knight)
+		FOO(handB, Silver, f_hand_silver, e_hand_silver)
+		FOO(handW, Silver, e_hand_silver, f_hand_silver)
+		FOO(handB, Gold  , f_hand_gold  , e_hand_gold  )
+		FOO(handW, Gold  , e_hand_gold  , f_hand_gold  )
+		FOO(handB, Bishop, f_hand_bishop, e_hand_bishop)
+		FOO(handW, Bishop, e_hand_bishop, f_hand_bishop)
+		FOO(handB, Rook  , f_hand_rook  , e_hand_rook  )
+		FOO(handW, Rook  , e_hand_rook  , f_hand_rook  )
+#undef FOO
+		return nlist;
+	}
+
+#ifdef TWIG
+	void cpuid(int r[4], const int leaf, const int subleaf)
+	{
+#if defined(_MSC_VER)
+		__cpuidex(r, leaf, subleaf);
+#else
+		unsigned int a, b, c, d;
+		__cpuid_count(leaf, subleaf, a, b, c, d);
+		r[0] = int(a); r[1] = int(b); r[2] = int(c); r[3] = int(d);
+#endif
+	}
+
+	// XCR0(OS  AVX/AVX-512 ̃WX^ۑ邩)
+	uint64_t xgetbv0()
+	{
+#if defined(_MSC_VER)
+		return _xgetbv(0);
+#else
+		unsigned int a, d;
+		__asm__ volatile("xgetbv" : "=a"(a), "=d"(d) : "c"(0));
+		return (uint64_t(d) << 32) | a;
+#endif
+	}
+
+	// KPP ̑a߂J[lBsum.p[0], sum.p[1] ݒ肷B
+	// N CPUID  select_kpp_kernel() ŎĝIԁB
+	// EVAL_COMPACT ̂Ƃ list0, list1 ͂ꂼꏸɕł邱ƁB
+	typedef void (*KPPKernel)(EvalSum& sum, const int list0[], const int list1[], const int nlist, const int sq_bk, const int sq_wk);
+
+	void kpp_scalar(EvalSum& sum, const int list0[], const int list1[], const int nlist, const int sq_bk, const int sq_wk)
+	{
+		const auto* ppkppb = KPP[sq_bk     ];
+		const auto* ppkppw = KPP[Inv(sq_wk)];
+
+		sum.p[0][0] = 0;
+		sum.p[0][1] = 0;
+		sum.p[1][0] = 0;
+		sum.p[1][1] = 0;
+		for (int i = 1; i < nlist; ++i) {
+			const auto* pkppb = kpp_row(ppkppb, list0[i]);
+			const auto* pkppw = kpp_row(ppkppw, list1[i]);
+			for (int j = 0; j < i; ++j) {
+				sum.p[0] += pkppb[list0[j]];
+				sum.p[1] += pkppw[list1[j]];
+			}
+		}
+	}
+
+	// SSE4.1 ɂ gather ̂ŁAs̗vf(std::array<short, 2>) 32bit  2 ǂ
+	// 64bit ɂ܂Ƃ߁A1 ̕g 4  int32 ɂB
+	TARGET_SSE41 inline __m128i kpp_pair_sse41(const std::array<short, 2>* row, const int k0, const int k1)
+	{
+		const __m128i e0 = _mm_cvtsi32_si128(*reinterpret_cast<const int32_t*>(&row[k0][0]));
+		const __m128i e1 = _mm_cvtsi32_si128(*reinterpret_cast<const int32_t*>(&row[k1][0]));
+		return _mm_cvtepi16_epi32(_mm_unpacklo_epi32(e0, e1));
+	}
+
+	TARGET_SSE41 void kpp_sse41(EvalSum& sum, const int list0[], const int list1[], const int nlist, const int sq_bk, const int sq_wk)
+	{
+		const auto* ppkppb = KPP[sq_bk     ];
+		const auto* ppkppw = KPP[Inv(sq_wk)];
+
+		// e acc  [j  [0], [1], j  [0], [1]] 
+		__m128i accb = _mm_setzero_si128();
+		__m128i accw = _mm_setzero_si128();
+		for (int i = 1; i < nlist; ++i) {
+			const std::array<short, 2>* pkppb = kpp_row(ppkppb, list0[i]);
+			const std::array<short, 2>* pkppw = kpp_row(ppkppw, list1[i]);
+			int j = 0;
+			for (; j + 2 <= i; j += 2) {
+				accb = _mm_add_epi32(accb, kpp_pair_sse41(pkppb, list0[j], list0[j + 1]));
+				accw = _mm_add_epi32(accw, kpp_pair_sse41(pkppw, list1[j], list1[j + 1]));
+			}
+			if (j < i) {
+				// [B㔼ɂ 0 𑫂
+				accb = _mm_add_epi32(accb, _mm_cvtepi16_epi32(_mm_cvtsi32_si128(*reinterpret_cast<const int32_t*>(&pkppb[list0[j]][0]))));
+				accw = _mm_add_epi32(accw, _mm_cvtepi16_epi32(_mm_cvtsi32_si128(*reinterpret_cast<const int32_t*>(&pkppw[list1[j]][0]))));
+			}
+		}
+		accb = _mm_add_epi32(accb, _mm_srli_si128(accb, 8));
+		accw = _mm_add_epi32(accw, _mm_srli_si128(accw, 8));
+		sum.p[0][0] = _mm_cvtsi128_si32(accb);
+		sum.p[0][1] = _mm_extract_epi32(accb, 1);
+		sum.p[1][0] = _mm_cvtsi128_si32(accw);
+		sum.p[1][1] = _mm_extract_epi32(accw, 1);
+	}
+
+	// KPP ̗vf(std::array<short, 2>) int32 Ƃ gather A㉺ 16bit ɕđB
+	TARGET_AVX2 inline int hsum_avx2(const __m256i v)
+	{
+		__m128i s = _mm_add_epi32(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+		s = _mm_add_epi32(s, _mm_shuffle_epi32(s, _MM_SHUFFLE(1, 0, 3, 2)));
+		s = _mm_add_epi32(s, _mm_shuffle_epi32(s, _MM_SHUFFLE(2, 3, 0, 1)));
+		return _mm_cvtsi128_si32(s);
+	}
+
+	TARGET_AVX2 void kpp_avx2(EvalSum& sum, const int list0[], const int list1[], const int nlist, const int sq_bk, const int sq_wk)
+	{
+		const auto* ppkppb = KPP[sq_bk     ];
+		const auto* ppkppw = KPP[Inv(sq_wk)];
+
+		const __m256i lane = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+		__m256i accb0 = _mm256_setzero_si256();
+		__m256i accb1 = _mm256_setzero_si256();
+		__m256i accw0 = _mm256_setzero_si256();
+		__m256i accw1 = _mm256_setzero_si256();
+		for (int i = 1; i < nlist; ++i) {
+			const int* pkppb = reinterpret_cast<const int*>(kpp_row(ppkppb, list0[i]));
+			const int* pkppw = reinterpret_cast<const int*>(kpp_row(ppkppw, list1[i]));
+			for (int j = 0; j < i; j += 8) {
+				__m256i b, w;
+				if (j + 8 <= i) {
+					const __m256i idx0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&list0[j]));
+					const __m256i idx1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&list1[j]));
+					b = _mm256_i32gather_epi32(pkppb, idx0, 4);
+					w = _mm256_i32gather_epi32(pkppw, idx1, 4);
+				} else {
+					// [Blist ͈̔͊O͓ǂ܂Ȃ
+					const __m256i mask = _mm256_cmpgt_epi32(_mm256_set1_epi32(i - j), lane);
+					const __m256i idx0 = _mm256_maskload_epi32(&list0[j], mask);
+					const __m256i idx1 = _mm256_maskload_epi32(&list1[j], mask);
+					b = _mm256_mask_i32gather_epi32(_mm256_setzero_si256(), pkppb, idx0, mask, 4);
+					w = _mm256_mask_i32gather_epi32(_mm256_setzero_si256(), pkppw, idx1, mask, 4);
+				}
+				accb0 = _mm256_add_epi32(accb0, _mm256_srai_epi32(_mm256_slli_epi32(b, 16), 16));
+				accb1 = _mm256_add_epi32(accb1, _mm256_srai_epi32(b, 16));
+				accw0 = _mm256_add_epi32(accw0, _mm256_srai_epi32(_mm256_slli_epi32(w, 16), 16));
+				accw1 = _mm256_add_epi32(accw1, _mm256_srai_epi32(w, 16));
+			}
+		}
+		sum.p[0][0] = hsum_avx2(accb0);
+		sum.p[0][1] = hsum_avx2(accb1);
+		sum.p[1][0] = hsum_avx2(accw0);
+		sum.p[1][1] = hsum_avx2(accw1);
+	}
+
+#if defined HAVE_AVX512_INTRIN
+	// AVX2 łƓƂ 16 vfsB[̓}XNŏB
+	TARGET_AVX512 void kpp_avx512(EvalSum& sum, const int list0[], const int list1[], const int nlist, const int sq_bk, const int sq_wk)
+	{
+		const auto* ppkppb = KPP[sq_bk     ];
+		const auto* ppkppw = KPP[Inv(sq_wk)];
+
+		__m512i accb0 = _mm512_setzero_si512();
+		__m512i accb1 = _mm512_setzero_si512();
+		__m512i accw0 = _mm512_setzero_si512();
+		__m512i accw1 = _mm512_setzero_si512();
+		for (int i = 1; i < nlist; ++i) {
+			const int* pkppb = reinterpret_cast<const int*>(kpp_row(ppkppb, list0[i]));
+			const int* pkppw = reinterpret_cast<const int*>(kpp_row(ppkppw, list1[i]));
+			for (int j = 0; j < i; j += 16) {
+				const __mmask16 mask = (i - j >= 16) ? __mmask16(0xFFFF) : __mmask16((1u << (i - j)) - 1);
+				const __m512i idx0 = _mm512_maskz_loadu_epi32(mask, &list0[j]);
+				const __m512i idx1 = _mm512_maskz_loadu_epi32(mask, &list1[j]);
+				const __m512i b = _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), mask, idx0, pkppb, 4);
+				const __m512i w = _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), mask, idx1, pkppw, 4);
+				accb0 = _mm512_add_epi32(accb0, _mm512_srai_epi32(_mm512_slli_epi32(b, 16), 16));
+				accb1 = _mm512_add_epi32(accb1, _mm512_srai_epi32(b, 16));
+				accw0 = _mm512_add_epi32(accw0, _mm512_srai_epi32(_mm512_slli_epi32(w, 16), 16));
+				accw1 = _mm512_add_epi32(accw1, _mm512_srai_epi32(w, 16));
+			}
+		}
+		sum.p[0][0] = _mm512_reduce_add_epi32(accb0);
+		sum.p[0][1] = _mm512_reduce_add_epi32(accb1);
+		sum.p[1][0] = _mm512_reduce_add_epi32(accw0);
+		sum.p[1][1] = _mm512_reduce_add_epi32(accw1);
+	}
+#endif
+
+	// CPU  OS ΉĂԑJ[lI
+	KPPKernel select_kpp_kernel()
+	{
+		int r[4];
+		cpuid(r, 0, 0);
+		const int maxLeaf = r[0];
+		cpuid(r, 1, 0);
+		const bool sse41   = (r[2] & (1 << 19)) != 0;
+		const bool osxsave = (r[2] & (1 << 27)) != 0;
+		const bool avx     = (r[2] & (1 << 28)) != 0;
+		const uint64_t xcr0 = osxsave ? xgetbv0() : 0;
+		bool avx2 = false, avx512 = false;
+		if (maxLeaf >= 7) {
+			cpuid(r, 7, 0);
+			avx2   = avx && (xcr0 & 0x06) == 0x06 && (r[1] & (1 << 5)) != 0;
+			avx512 = avx2 && (xcr0 & 0xE6) == 0xE6 && (r[1] & (1 << 16)) != 0;
+		}
+#if defined HAVE_AVX512_INTRIN
+		if (avx512) return kpp_avx512;
+#else
+		(void)avx512;
+#endif
+		if (avx2)   return kpp_avx2;
+		if (sse41)  return kpp_sse41;
+		return kpp_scalar;
+	}
+
+	const KPPKernel KPPSum = select_kpp_kernel();
+
+	// KK, KKP, KPP SČvZ(MATERIAL ͊܂܂Ȃ)
+	void calc_full(EvalSum& sum, const int list0[], const int list1[], const int nlist, const int sq_bk, const int sq_wk)
+	{
+#if defined(EVAL_COMPACT)
+		// Op`̃e[u i > j ̂̕ŁAבւĂ瑫
+		int kpp0[NLIST], kpp1[NLIST];
+		std::copy(list0, list0 + nlist, kpp0);
+		std::copy(list1, list1 + nlist, kpp1);
+		std::sort(kpp0, kpp0 + nlist);
+		std::sort(kpp1, kpp1 + nlist);
+#else
+		const int* const kpp0 = list0;
+		const int* const kpp1 = list1;
+#endif
+		KPPSum(sum, kpp0, kpp1, nlist, sq_bk, sq_wk);
+#ifdef _DEBUG
+		EvalSum check;
+		kpp_scalar(check, kpp0, kpp1, nlist, sq_bk, sq_wk);
+		assert(check.p[0] == sum.p[0] && check.p[1] == sum.p[1]);
+#endif
+
+		sum.p[2] = KK[sq_bk][sq_wk];
+		for (int i = 0; i < nlist; ++i) {
+			sum.p[2] += KKP[sq_bk][sq_wk][list0[i]];
+		}
+	}
+
+	// O̎ŕὠʂ߂B
+	// add0/add1 V́Adel0/del1 Ȃ́B
+	// handCount ͎w( or ł)̖B
+	// ߂l͕ω̐(1`2)BʂƂ͍vZłȂ̂ -1 ԂB
+	int changed_list(const Move m, const Piece after, const Piece captured, const int handCount,
+	                 int add0[2], int add1[2], int del0[2], int del1[2])
+	{
+		const Piece piece = move_piece(m);
+		const Color us = color_of(piece);
+		const int to = conv_z2sq(move_to(m));
+
+		if (move_is_drop(m)) {
+			// ̍Ō1(łÖ̖ʒu)ՏɈڂ
+			const int kind = piece & ~GOTE;
+			const int n = handCount + 1;
+			del0[0] = (us == BLACK ? hand_base_tbl[kind].f_pt : hand_base_tbl[kind].e_pt) + n;
+			del1[0] = (us == BLACK ? hand_base_tbl[kind].e_pt : hand_base_tbl[kind].f_pt) + n;
+			add0[0] = base_tbl[piece].f_pt + to;
+			add1[0] = base_tbl[piece].e_pt + Inv(to);
+			return 1;
+		}
+
+		// ʂ KPP ̎QƐ悪Sĕς
+		if (piece == SOU || piece == GOU) return -1;
+
+		const int from = conv_z2sq(move_from(m));
+		del0[0] = base_tbl[piece].f_pt + from;
+		del1[0] = base_tbl[piece].e_pt + Inv(from);
+		add0[0] = base_tbl[after].f_pt + to;
+		add1[0] = base_tbl[after].e_pt + Inv(to);
+		if (captured == EMP) return 1;
+
+		// ͎̍Ō1(̖̈ʒu)ɂȂ
+		const int kind = captured & ~(GOTE | PROMOTED);
+		del0[1] = base_tbl[captured].f_pt + to;
+		del1[1] = base_tbl[captured].e_pt + Inv(to);
+		add0[1] = (us == BLACK ? hand_base_tbl[kind].f_pt : hand_base_tbl[kind].e_pt) + handCount;
+		add1[1] = (us == BLACK ? hand_base_tbl[kind].e_pt : hand_base_tbl[kind].f_pt) + handCount;
+		return 2;
+	}
+
+	// Őǖʂ sum ɁAω n ̋̕ KPP, KKP 
+	// list0/list1 ͎w̋ǖʂ̂
+	void calc_diff(EvalSum& sum, const int list0[], const int list1[], const int nlist, const int sq_bk, const int sq_wk,
+	               const int n, const int add0[], const int add1[], const int del0[], const int del1[])
+	{
+		const auto* ppkppb = KPP[sq_bk     ];
+		const auto* ppkppw = KPP[Inv(sq_wk)];
+
+		for (int c = 0; c < n; ++c) {
+			for (int i = 0; i < nlist; ++i) {
+				const int l0 = list0[i];
+				// ωm͌̕ł܂Ƃ߂ČvZ
+				if (l0 == add0[0] || (n == 2 && l0 == add0[1])) continue;
+				const int l1 = list1[i];
+				sum.p[0] += kpp_at(ppkppb, add0[c], l0);
+				sum.p[0] -= kpp_at(ppkppb, del0[c], l0);
+				sum.p[1] += kpp_at(ppkppw, add1[c], l1);
+				sum.p[1] -= kpp_at(ppkppw, del1[c], l1);
+			}
+			sum.p[2] += KKP[sq_bk][sq_wk][add0[c]];
+			sum.p[2] -= KKP[sq_bk][sq_wk][del0[c]];
+		}
+		if (n == 2) {
+			sum.p[0] += kpp_at(ppkppb, add0[0], add0[1]);
+			sum.p[0] -= kpp_at(ppkppb, del0[0], del0[1]);
+			sum.p[1] += kpp_at(ppkppw, add1[0], add1[1]);
+			sum.p[1] -= kpp_at(ppkppw, del1[0], del1[1]);
+		}
+	}
+#endif
+}
+
+//int Position::make_list_apery(int list0[NLIST], int list1[NLIST], int nlist) const
+int Position::make_list_apery(int list0[], int list1[], int nlist) const
+{
 	int sq;
 
 	// ԍF1`2ʁA3`40ʈȊO
@@ -465,49 +1074,23 @@ int Position::evaluate(const Color us) const
 {
 	int list0[NLIST], list1[NLIST];
 	int sq_bk, sq_wk;
-#ifndef TWIG
-	int score;
-#else
-	EvalSum score;
-#endif
 	static int count=0;
 	count++;
-	int nlist=0;
-
-	// Xg
-#define FOO(hand, Piece, list0_index, list1_index)    \
-	for (int i = I2Hand##Piece(hand); i >= 1; --i) {  \
-		list0[nlist] = list0_index + i;               \
-		list1[nlist] = list1_index + i;               \
-		++nlist; \
-	}
-
-	FOO(HAND_B, Pawn  , f_hand_pawn  , e_hand_pawn  )
-	FOO(HAND_W, Pawn  , e_hand_pawn  , f_hand_pawn  )
-	FOO(HAND_B, Lance , f_hand_lance , e_hand_lance )
-	FOO(HAND_W, Lance , e_hand_lance , f_hand_lance )
-	FOO(HAND_B, Knight, f_hand_knight, e_hand_knight)
-	FOO(HAND_W, Knight, e_hand_knight, f_hand_knight)
-	FOO(HAND_B, Silver, f_hand_silver, e_hand_silver)
-	FOO(HAND_W, Silver, e_hand_silver, f_hand_silver)
-	FOO(HAND_B, Gold  , f_hand_gold  , e_hand_gold  )
-	FOO(HAND_W, Gold  , e_hand_gold  , f_hand_gold  )
-	FOO(HAND_B, Bishop, f_hand_bishop, e_hand_bishop)
-	FOO(HAND_W, Bishop, e_hand_bishop, f_hand_bishop)
-	FOO(HAND_B, Rook  , f_hand_rook  , e_hand_rook  )
-	FOO(HAND_W, Rook  , e_hand_rook  , f_hand_rook  )
-#undef FOO
-
-	nlist = make_list_apery(list0, list1, nlist);
+	int nlist;
 
 	sq_bk = SQ_BKING;
 	sq_wk = SQ_WKING;
 	assert(0 <= sq_bk && sq_bk < nsquare);
 	assert(0 <= sq_wk && sq_wk < nsquare);
+
+#ifndef TWIG
+	int score;
+
+	nlist = make_list_apery(list0, list1, make_hand_list(HAND_B, HAND_W, list0, list1));
+
 	const auto* ppkppb = KPP[sq_bk     ];
 	const auto* ppkppw = KPP[Inv(sq_wk)];
 
-#ifndef TWIG
 	score = fv_kk[sq_bk][sq_wk];
 	for (int i = 0; i < nlist; i++ ) {
 		const int k0 = list0[i];
@@ -535,78 +1118,56 @@ int Position::evaluate(const Color us) const
 	return score;
 #else
 	EvalSum sum;
-	sum.p[2] = KK[sq_bk][sq_wk];
-#if defined USE_AVX2_EVAL || defined USE_SSE_EVAL
-	sum.m[0] = _mm_setzero_si128();
-	for (int i = 0; i < nlist; ++i) {
-		const int k0 = list0[i];
-		const int k1 = list1[i];
-		const auto* pkppb = ppkppb[k0];
-		const auto* pkppw = ppkppw[k1];
-		for (int j = 0; j < i; ++j) {
-			const int l0 = list0[j];
-			const int l1 = list1[j];
-			__m128i tmp;
-			tmp = _mm_set_epi32(0, 0, *reinterpret_cast<const int32_t*>(&pkppw[l1][0]), *reinterpret_cast<const int32_t*>(&pkppb[l0][0]));
-			tmp = _mm_cvtepi16_epi32(tmp);
-			sum.m[0] = _mm_add_epi32(sum.m[0], tmp);
-		}
-		sum.p[2] += KKP[sq_bk][sq_wk][k0];
-	}
-	sum.p[2][0] += MATERIAL * FV_SCALE;
+	const StateInfo* const prev = st->previous;
 
-#else
-	// loop Jn i = 1 ɂāAi = 0 ̕KKPɑB
-	sum.p[2] += KKP[sq_bk][sq_wk][list0[0]];
-	sum.p[0][0] = 0;
-	sum.p[0][1] = 0;
-	sum.p[1][0] = 0;
-	sum.p[1][1] = 0;
-	for (int i = 1; i < nlist; ++i) {
-		const int k0 = list0[i];
-		const int k1 = list1[i];
-		const auto* pkppb = ppkppb[k0];
-		const auto* pkppw = ppkppw[k1];
-		for (int j = 0; j < i; ++j) {
-			const int l0 = list0[j];
-			const int l1 = list1[j];
-			sum.p[0] += pkppb[l0];
-			sum.p[1] += pkppw[l1];
-		}
-		sum.p[2] += KKP[sq_bk][sq_wk][k0];
-	}
-	sum.p[2][0] += MATERIAL * FV_SCALE;
-#endif
+	if (st->evalComputed) {
+		// vZς
+		std::memcpy(&sum.p, st->evalSum, sizeof(st->evalSum));
+	} else {
+		if (st->lastMove == MOVE_NULL && prev != nullptr && prev->evalComputed) {
+			// pXł͔ՖʂςȂ
+			std::memcpy(&sum.p, prev->evalSum, sizeof(prev->evalSum));
+		} else if (EHash.probe(st->key, sum)) {
+			// ehash ɂ KPP ̌vZ͕sv
+		} else {
+			nlist = make_list_apery(list0, list1, make_hand_list(HAND_B, HAND_W, list0, list1));
 
-#ifdef _DEBUG
-	score.p[2] = KK[sq_bk][sq_wk];
+			// ŐǖʂvZς݂ȂA̕vZ
+			int add0[2], add1[2], del0[2], del1[2];
+			int n = -1;
+			const Move m = st->lastMove;
+			if (prev != nullptr && prev->evalComputed && m != MOVE_NONE && m != MOVE_NULL) {
+				const Piece after = move_is_drop(m) ? EMP : ban[move_to(m)];
+				const int kind = move_is_drop(m) ? (move_piece(m) & ~GOTE) : (st->captured & ~(GOTE | PROMOTED));
+				const int handCount = kind ? hand[flip(sideToMove)].getFromKind(kind) : 0;
+				n = changed_list(m, after, st->captured, handCount, add0, add1, del0, del1);
+			}
 
-	score.p[0][0] = 0;
-	score.p[0][1] = 0;
-	score.p[1][0] = 0;
-	score.p[1][1] = 0;
+			if (n > 0) {
+				std::memcpy(&sum.p, prev->evalSum, sizeof(prev->evalSum));
+				calc_diff(sum, list0, list1, nlist, sq_bk, sq_wk, n, add0, add1, del0, del1);
+			} else {
+				calc_full(sum, list0, list1, nlist, sq_bk, sq_wk);
+			}
 
-	for (int i = 0; i < nlist; ++i) {
-		const int k0 = list0[i];
-		const int k1 = list1[i];
-		const auto* pkppb = ppkppb[k0];
-		const auto* pkppw = ppkppw[k1];
-		for (int j = 0; j < i; ++j) {
-			const int l0 = list0[j];
-			const int l1 = list1[j];
-			score.p[0][0] += pkppb[l0][0];
-			score.p[0][1] += pkppb[l0][1];
-			score.p[1][0] += pkppw[l1][0];
-			score.p[1][1] += pkppw[l1][1];
+			EHash.store(st->key, sum);
 		}
-		score.p[2][0] += KKP[sq_bk][sq_wk][k0][0];
-		score.p[2][1] += KKP[sq_bk][sq_wk][k0][1];
+
+		std::memcpy(st->evalSum, &sum.p, sizeof(st->evalSum));
+		st->evalComputed = true;
 	}
 
-	score.p[2][0] += MATERIAL * FV_SCALE;
-	assert(score.sum(us) == sum.sum(us));
+#ifdef _DEBUG
+	{
+		EvalSum score;
+		nlist = make_list_apery(list0, list1, make_hand_list(HAND_B, HAND_W, list0, list1));
+		calc_full(score, list0, list1, nlist, sq_bk, sq_wk);
+		assert(score.p == sum.p);
+	}
 #endif
 
+	sum.p[2][0] += MATERIAL * FV_SCALE;
+
 	return sum.sum(us) / FV_SCALE ;
 
 #endif
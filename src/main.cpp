@@ -27,6 +27,9 @@
 #ifndef NANOHA
 #include "bitboard.h"
 #endif
+#ifdef NANOHA
+#include "dfpn.h"
+#endif
 #include "evaluate.h"
 #include "position.h"
 #include "search.h"
@@ -43,14 +46,12 @@ int main(int argc, char* argv[]) {
 
   UCI::init(Options);
 #ifdef NANOHA
+  Position::init(); // The book index is keyed by Position::key()
   init_application_once();
-#endif
-#ifndef NANOHA
+#else
   PSQT::init();
   Bitboards::init();
-#endif
   Position::init();
-#ifndef NANOHA
   Bitbases::init();
 #endif
   Search::init();
@@ -62,7 +63,16 @@ int main(int argc, char* argv[]) {
 #ifndef NANOHA
   Tablebases::init(Options["SyzygyPath"]);
 #endif
+  TT.set_alloc_policy(Options["Large_Pages"], Options["NUMA_Interleave"], Options["Shared_Hash"]);
   TT.resize(Options["Hash"]);
+#if defined(EVAL_APERY) && defined(TWIG)
+  Eval::resize_hash(Options["EvalHash"]);
+#endif
+#ifdef NANOHA
+  MateSearch.resize(Options["MateHash"]);
+  resize_mate3_hash(Options["Mate3Hash"]);
+  resize_mate7_hash(Options["Mate7Hash"]);
+#endif
 
   UCI::loop(argc, argv);
 
@@ -22,11 +22,15 @@
   along with this program.  If not, see <http://www.gnu.org/licenses/>.
 */
 
-#include <cassert>
+#include <algorithm>
+#include <cassert>
+#include <cstdlib>
+#include <cstring>
 #include <fstream>
 #include <iostream>
 #include "movegen.h"
 #include "position.h"
+#include "thread.h"
 
 #define USE_M3HASH	// Mate3()ʂnbV.
 
@@ -38,53 +42,138 @@
 Move pre_check;
 #endif
 
-#if defined(USE_M3HASH)
-#define MATE3_MASK              0x07ffffU	/* 8 * 64K = 512K entry */
+namespace {
+// Mate3()AMateN() ̌ʂunbV.
+// 4Gg(64byte)1NX^ƂAVʂNX^̐擪ɓčłÂ̂ǂo.
+// SXbh烍bNȂœǂݏ̂ŁAGgƂ word1^word2 ŃL[m߂.
+class MateHashTable {
+public:
+	MateHashTable() : table(nullptr), mem(nullptr), clusterMask(0) {}
+
+	// TCYMBP
+	void resize(size_t mbSize)
+	{
+		const size_t clusterCount = size_t(1) << msb((std::max(mbSize, size_t(1)) * 1024 * 1024) / (sizeof(Entry) * ClusterSize));
 
-// ptH[}Xvp.
-namespace M3Perform{
-uint64_t called;
-uint64_t hashhit;
-uint64_t override;
-}
+		if (table != nullptr && clusterCount == clusterMask + 1)
+			return;
 
-namespace {
-struct Mate3_Hash {
-	uint64_t word1, word2;				// word1:key, word2:0-31=black_hand, word2:32-63=move
-} mate3_hash_tbl[ MATE3_MASK + 1 ];
+		free(mem);
+		mem = calloc(clusterCount * ClusterSize * sizeof(Entry) + CacheLineSize - 1, 1);
+		if (!mem)
+		{
+			std::cerr << "Failed to allocate " << mbSize
+			          << "MB for mate hash." << std::endl;
+			exit(EXIT_FAILURE);
+		}
 
-bool probe_m3hash(const Position& pos, Move &m)
-{
-	uint64_t word1, word2;
-	const uint64_t key = pos.key();
-	const uint32_t h = pos.handValue<BLACK>();
-	const uint32_t index = static_cast<uint32_t>(key) ^ h ^ (h >> 15);
-	const Mate3_Hash now = mate3_hash_tbl[index & MATE3_MASK];
-	word1 = now.word1 ^ now.word2;
-	word2 = now.word2;
-
-	if (word1 != key || static_cast<uint32_t>(word2) != pos.handValue<BLACK>()) {
+		table = (Entry*)((uintptr_t(mem) + CacheLineSize - 1) & ~(CacheLineSize - 1));
+		clusterMask = clusterCount - 1;
+	}
+
+	void clear()
+	{
+		if (table != nullptr)
+			std::memset(table, 0, entries() * sizeof(Entry));
+	}
+
+	// data 32bit̔Cӂ̒l(Mate3()͎wAMateN()͎wƐ[)
+	bool probe(const Position& pos, uint32_t &data) const
+	{
+		const uint64_t key = pos.key();
+		const uint32_t h = pos.handValue<BLACK>();
+		const Entry* const cluster = find_cluster(key, h);
+
+		for (int i = 0; i < ClusterSize; i++) {
+			const Entry now = cluster[i];
+			if (now.is(key, h)) {
+				data = static_cast<uint32_t>(now.word2 >> 32);
+				return true;
+			}
+		}
 		return false;
 	}
-	m = static_cast<Move>(word2 >> 32);
-	return true;
+
+	// LȃGgǂo true Ԃ
+	bool store(const Position& pos, const uint32_t data)
+	{
+		Entry now;
+		const uint64_t key = pos.key();
+		const uint32_t h = pos.handValue<BLACK>();
+		now.word2 = static_cast<uint64_t>(h) | (static_cast<uint64_t>(data) << 32);
+		now.word1 = key ^ now.word2;
+
+		Entry* const cluster = find_cluster(key, h);
+		int i;
+		for (i = 0; i < ClusterSize - 1; i++) {
+			if (cluster[i].is(key, h)) break;
+		}
+		const bool evicted = (i == ClusterSize - 1) && (cluster[i].word1 | cluster[i].word2) != 0 && !cluster[i].is(key, h);
+		for (; i > 0; i--) {
+			cluster[i] = cluster[i - 1];
+		}
+		cluster[0] = now;
+		return evicted;
+	}
+
+	size_t entries() const { return (clusterMask + 1) * ClusterSize; }
+
+	// gp̃GgƁÂ data 0(l܂Ȃ)łȂ̂̐
+	void usage(size_t &used, size_t &mate) const
+	{
+		used = mate = 0;
+		for (size_t i = 0; table != nullptr && i < entries(); i++) {
+			if (table[i].word1 != 0 || table[i].word2 != 0) {
+				used++;
+				if ((table[i].word2 >> 32) != 0) mate++;
+			}
+		}
+	}
+
+private:
+	struct Entry {
+		uint64_t word1, word2;				// word1:key^word2, word2:0-31=black_hand, word2:32-63=data
+		bool is(const uint64_t key, const uint32_t h) const {
+			return (word1 ^ word2) == key && static_cast<uint32_t>(word2) == h;
+		}
+	};
+	static const int ClusterSize = 4;
+	static const int CacheLineSize = 64;
+
+	Entry* find_cluster(const uint64_t key, const uint32_t h) const
+	{
+		const size_t index = static_cast<size_t>(key) ^ h ^ (h >> 15);
+		return &table[(index & clusterMask) * ClusterSize];
+	}
+
+	Entry* table;
+	void* mem;
+	size_t clusterMask;
+};
+
+MateHashTable Mate3Hash;
+MateHashTable MateNHash;
+
+// MateN() ̃nbV data : 0-28=w(MOVE_NONEȂl܂Ȃ)A29-31=ׂ[
+const int MateNDepthShift = 29;
 }
 
-void store_m3hash(const Position& pos, const Move m)
+// TCYMBP(Mate3()pMate3HashAMateN()pMate7Hash̑傫)
+void resize_mate3_hash(size_t mbSize)
 {
-	Mate3_Hash now;
-	const uint64_t key = pos.key();
-	const uint32_t h = pos.handValue<BLACK>();
-	now.word2 = static_cast<uint64_t>(h) | (static_cast<uint64_t>(m) << 32);
-	now.word1 = key ^ now.word2;
-
-	const uint32_t index = static_cast<uint32_t>(key) ^ h ^ (h >> 15);
-	if (mate3_hash_tbl[index & MATE3_MASK].word1 != 0) M3Perform::override++;
-	mate3_hash_tbl[index & MATE3_MASK] = now;
+	Mate3Hash.resize(mbSize);
 }
 
+void resize_mate7_hash(size_t mbSize)
+{
+	MateNHash.resize(mbSize);
+}
+
+void clear_mate3_hash()
+{
+	Mate3Hash.clear();
+	MateNHash.clear();
 }
-#endif
 
 //
 //  ʂƂ̈ʒu֌W
@@ -1777,7 +1866,7 @@ MYABORT();
 int Position::Mate3(const Color us, Move &m)
 {
 #if defined(USE_M3HASH)
-	M3Perform::called++;
+	this_thread()->mate3Called++;
 #endif
 	assert(us == side_to_move());
 	// 1l߂mF
@@ -1788,8 +1877,10 @@ int Position::Mate3(const Color us, Move &m)
 	}
 
 #if defined(USE_M3HASH)
-	if (probe_m3hash(*this, m)) {
-		M3Perform::hashhit++;
+	uint32_t data;
+	if (Mate3Hash.probe(*this, data)) {
+		m = static_cast<Move>(data);
+		this_thread()->mate3HashHit++;
 		return m == MOVE_NONE ? -VALUE_MATE : VALUE_MATE;
 	}
 #endif
@@ -1822,14 +1913,14 @@ int Position::Mate3(const Color us, Move &m)
 		if (valmax == VALUE_MATE) {
 			m = move;
 #if defined(USE_M3HASH)
-			store_m3hash(*this, move);
+			if (Mate3Hash.store(*this, move)) this_thread()->mate3Override++;
 #endif
 			return VALUE_MATE; //l
 		}
 	}
 
 #if defined(USE_M3HASH)
-	store_m3hash(*this, MOVE_NONE);
+	if (Mate3Hash.store(*this, MOVE_NONE)) this_thread()->mate3Override++;
 #endif
 	return valmax;
 }
@@ -1927,29 +2018,161 @@ int Position::EvasionRest2(const Color us, MoveStack *antichecks)
 	return VALUE_MATE;
 }
 
+//
+// (maxPlyȓ)̋l݂ 1A3A5cƔ[ŒׂB
+// FColor us				(BLACKFAWHITEF)
+//		 int maxPly				ׂő̎萔()
+//		 Move &m				l܂Ԃ
+//		 int &matePly			l݂܂ł̎萔Ԃ
+//		 int64_t nodes			ׂǖʐ̏
+// ߂lFint					lނǂ(VALUE_MATE:lށA-VALUE_MATEFl݂ȂAVALUE_ZEROFǖʐ̏ɒB)
+//
+int Position::MateN(const Color us, const int maxPly, Move &m, int &matePly, int64_t nodes)
+{
+	assert(us == side_to_move());
+	{
+		uint32_t refInfo;
+		int val = (us == BLACK) ? Mate1ply<BLACK>(m, refInfo) :  Mate1ply<WHITE>(m, refInfo);
+		if (val == VALUE_MATE) {
+			matePly = 1;
+			return val;
+		}
+	}
+
+	for (int depth = 3; depth <= maxPly; depth += 2) {
+		int val = MateRestN(us, depth, m, nodes);
+		if (val == VALUE_MATE) {
+			matePly = depth;
+			return val;
+		}
+		if (nodes <= 0) return VALUE_ZERO;
+	}
+	return -VALUE_MATE;
+}
+
+//
+// c depth ()ŋlނǂ𒲂ׂB3ȉ Mate3() ɔCB
+// 1ׂ邲Ƃ nodes 炵A0 ȉɂȂł؂B
+// l݂Ȃʂ́Ał؂ĂȂƂnbVɒuB
+//
+int Position::MateRestN(const Color us, const int depth, Move &m, int64_t &nodes)
+{
+	nodes--;
+	if (depth <= 3) return Mate3(us, m);
+
+	{
+		uint32_t refInfo;
+		int val = (us == BLACK) ? Mate1ply<BLACK>(m, refInfo) :  Mate1ply<WHITE>(m, refInfo);
+		if (val == VALUE_MATE) return val;
+	}
+
+	uint32_t data;
+	if (MateNHash.probe(*this, data)) {
+		const Move hashMove = static_cast<Move>(data & ((1u << MateNDepthShift) - 1));
+		const int hashDepth = data >> MateNDepthShift;
+		if (hashMove != MOVE_NONE && hashDepth <= depth) {
+			m = hashMove;
+			return VALUE_MATE;
+		}
+		if (hashMove == MOVE_NONE && hashDepth >= depth) {
+			return -VALUE_MATE;
+		}
+	}
+
+	MoveStack moves[256];
+	MoveStack *cur, *last;
+	bool bUchifudume = false;
+
+	last = (us == BLACK) ? generate_check3<BLACK>(moves, bUchifudume)
+	                     : generate_check3<WHITE>(moves, bUchifudume);
+
+	for (cur = moves; cur != last && nodes > 0; cur++) {
+		StateInfo newSt;
+		Move move = cur->move;
+		// Mate3()ƓAs͓ǂ܂Ȃ
+		if ((move & MOVE_CHECK_NARAZU)) continue;
+		do_move(move, newSt,0);
+#if defined(DEBUG_MATE2)
+		pre_check = move;
+#endif
+		int val = EvasionRestN(flip(us), depth - 1, nodes);
+		undo_move(move);
+
+		if (val == VALUE_MATE) {
+			m = move;
+			MateNHash.store(*this, static_cast<uint32_t>(move) | (depth << MateNDepthShift));
+			return VALUE_MATE;
+		}
+	}
+
+	if (nodes <= 0) return VALUE_ZERO;
+	MateNHash.store(*this, static_cast<uint32_t>(MOVE_NONE) | (depth << MateNDepthShift));
+	return -VALUE_MATE;
+}
+
+//
+// 󂯂鑤(c depth A)BEvasionRest2() Ɠ󂯂𐶐A
+// 1łl܂Ȃ󂯂΂őł؂B
+//
+int Position::EvasionRestN(const Color us, const int depth, int64_t &nodes)
+{
+	if (!in_check()) {
+		output_info("Error!:%sʂɉ肪ĂȂI\n", us == BLACK ? "" : "");
+		return -VALUE_MATE;
+	}
+
+	const effect_t kiki = (us == BLACK) ? exist_effect<WHITE>(kingS) : exist_effect<BLACK>(kingG);
+	MoveStack evasions[256];
+	MoveStack *cur, *last;
+	int Ai = 0;
+	last = generate_evasion_rest2(us, evasions, kiki, Ai);
+	if (Ai != 0) {
+		int check = 0;
+		last = generate_evasion_rest2_MoveAi(us, last, kiki);
+		last = generate_evasion_rest2_DropAi(us, last, kiki, check);
+	}
+
+	StateInfo newSt;
+	Move m;
+	for (cur = evasions; cur != last; cur++) {
+		Move move = cur->move;
+		do_move(move, newSt,0);
+		int val = MateRestN(flip(us), depth - 1, m, nodes);
+		undo_move(move);
+
+		// l܂Ȃ󂯂(܂͑ł؂)
+		if (val != VALUE_MATE) {
+			return val;
+		}
+	}
+	// ǂĂlł܂
+	return VALUE_MATE;
+}
+
 // x`}[N̎̂݌Ă΂.
 void analize_mate3()
 {
 #if defined(USE_M3HASH)
+	// v̓XbhƂɎĂ̂ŁAōv
+	uint64_t called = 0, hashhit = 0, override = 0;
+	for (Thread* th : Threads) {
+		called   += th->mate3Called;
+		hashhit  += th->mate3HashHit;
+		override += th->mate3Override;
+	}
 	std::cerr << "\n==============================="
-	          << "\n Mate3() called  : " << M3Perform::called;
-	if (M3Perform::called > 0) {
-		std::cerr << "\n hash hit(count) : " << M3Perform::hashhit
-		          << "\n hash hit(%)     : " << (double)M3Perform::hashhit  / M3Perform::called * 100.0
-		          << "\n override(count) : " << M3Perform::override
-		          << "\n override(%)     : " << (double)M3Perform::override / M3Perform::called * 100.0;
+	          << "\n Mate3() called  : " << called;
+	if (called > 0) {
+		std::cerr << "\n hash hit(count) : " << hashhit
+		          << "\n hash hit(%)     : " << (double)hashhit  / called * 100.0
+		          << "\n override(count) : " << override
+		          << "\n override(%)     : " << (double)override / called * 100.0;
 		          
 	}
-	int count = 0;
-	int mate = 0;
-	for (int i = 0; i < MATE3_MASK+1; i++) {
-		if (mate3_hash_tbl[i].word1 != 0 || mate3_hash_tbl[i].word2 != 0) {
-			count++;
-			if (static_cast<Move>(mate3_hash_tbl[i].word2 >> 32) != MOVE_NONE) mate++;
-		}
-	}
+	size_t count, mate;
+	Mate3Hash.usage(count, mate);
 	if (count > 0) {
-		std::cerr << "\n used(%)         : " << (double)count * 100.0  / (MATE3_MASK+1)
+		std::cerr << "\n used(%)         : " << (double)count * 100.0  / Mate3Hash.entries()
 		          << "\n      mate(%)    : " << (double)mate * 100.0 / count
 		          << std::endl;
 	}
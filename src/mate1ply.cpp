@@ -38,20 +38,22 @@
 //  (2) ʂړ\ȃ}X(U̗ȂC ̋Ȃ)
 //  (3) ł͋ʂړ\ȃ}X(󔒂Ű)
 //  (4) 𓮂̃}X(ʈȊO̗ȂU̗2ȏ゠悤ȁC 󔒂܂͎̋̂)
-uint32_t Position::TblMate1plydrop[0x10000];
+#include "mate1ply_tbl.h"	// TblMate1plydrop[]  DirTbl[] ̏l(makeTblMate1plydrop(), makeDirTbl() Ő)
 static uint8_t TblKikiCheck[32];				// [̎]  ɂȂʒu
 static uint8_t TblKikiKind[8][32];			// [][̎]  
 static uint8_t TblKikiIntercept[8][12][32];	// [̕][̕][̎]  Ղ
 
+// ȉ̐ initMate1ply() ł̊mF mate1ply_tbl.h ̍蒼ɂgȂ
+#if !defined(NDEBUG) || defined(GEN_STATIC_TABLES)
 // info (1) (2) ̑gݍ킹(킹16 bit) 
 // ւāC (1) ̂ǂɋłs(2) ǂ̂ɕKv
 // Ȏ̎ނ炩ߋ߂ĕ\ɕۑĂD
 // Ώۂ͍AAApA
 //   ͑łl߂ƂȂ邽ߏO
 //   j8ߖTł͌Ȃ̂ŏO
-void Position::initMate1ply()
+static void makeTblMate1plydrop(uint32_t tbl[0x10000])
 {
-	memset(TblMate1plydrop, 0, sizeof(TblMate1plydrop));
+	memset(tbl, 0, sizeof(uint32_t) * 0x10000);
 
 	// ̒`
 	//  Dir05 Dir00 Dir04
@@ -67,80 +69,80 @@ void Position::initMate1ply()
 				// FΏۊO
 				// F˕lߗpɓo^
 				if ((i2 & ~(KIKI00)) == 0) {
-					TblMate1plydrop[i2 * 256 + i1] |= (1u << GFU);
+					tbl[i2 * 256 + i1] |= (1u << GFU);
 				}
 				// 荁͑ΏۊO
 				// 荁(DIR00  DIR01 ȊOɓȂƋl))
 				if ((i2 & ~(KIKI00 | KIKI01)) == 0) {
-					TblMate1plydrop[i2 * 256 + i1] |= (1u << GKY);
+					tbl[i2 * 256 + i1] |= (1u << GKY);
 				}
 				// ͑ΏۊO
 				// (DIR00  DIR02  DIR03 ȊOɓȂƋl))
 				if ((i2 & ~(KIKI00 | KIKI02 | KIKI03)) == 0) {
-					TblMate1plydrop[i2 * 256 + i1] |= (1u << GGI);
+					tbl[i2 * 256 + i1] |= (1u << GGI);
 				}
 				// (DIR00, DIR04, DIR05 ȊOɓȂƋl)
 				if ((i2 & ~(KIKI00 | KIKI04 | KIKI05)) == 0) {
-					TblMate1plydrop[i2 * 256 + i1] |= (1u << SKI)
+					tbl[i2 * 256 + i1] |= (1u << SKI)
 						| (1u << STO) | (1u << SNY) | (1u << SNK) | (1u << SNG);
 				}
 				// (DIR00, DIR02, DIR03, DIR04, DIR05 ȊOɓȂƋl)
 				if ((i2 & ~(KIKI00 | KIKI02 | KIKI03 | KIKI04 | KIKI05)) == 0) {
-					TblMate1plydrop[i2 * 256 + i1] |= (1u << GKI)
+					tbl[i2 * 256 + i1] |= (1u << GKI)
 						| (1u << GTO) | (1u << GNY) | (1u << GNK) | (1u << GNG);
 				}
 				// p͑ΏۊO
 				// (DIR00, DIR01, DIR04, DIR05 ȊOɓȂƋl)
 				if ((i2 & ~(KIKI00 | KIKI01 | KIKI04 | KIKI05)) == 0) {
-					TblMate1plydrop[i2 * 256 + i1] |= (1u << SHI) | (1u << GHI);
+					tbl[i2 * 256 + i1] |= (1u << SHI) | (1u << GHI);
 				}
 				// n(DIR00, DIR02, DIR03, DIR04, DIR05 ȊOɓȂƋl)
 				if ((i2 & ~(KIKI00 | KIKI02 | KIKI03 | KIKI04 | KIKI05)) == 0) {
-					TblMate1plydrop[i2 * 256 + i1] |= (1u << SUM) | (1u << GUM);
+					tbl[i2 * 256 + i1] |= (1u << SUM) | (1u << GUM);
 				}
 				// (DIR00, DIR01, DIR02, DIR03, DIR04, DIR05 ȊOɓȂƋl)
 				if ((i2 & ~(KIKI00 | KIKI01 | KIKI02 | KIKI03 | KIKI04 | KIKI05)) == 0) {
-					TblMate1plydrop[i2 * 256 + i1] |= (1u << SRY) | (1u << GRY);
+					tbl[i2 * 256 + i1] |= (1u << SRY) | (1u << GRY);
 				}
 			}
 			if (i1 & KIKI01) {
 				// F˕lߗpɓo^
 				if ((i2 & ~(KIKI01)) == 0) {
-					TblMate1plydrop[i2 * 256 + i1] |= (1u << SFU);
+					tbl[i2 * 256 + i1] |= (1u << SFU);
 				}
 				// FΏۊO
 				// 荁(DIR00  DIR01 ȊOɓȂƋl))
 				if ((i2 & ~(KIKI00 | KIKI01)) == 0) {
-					TblMate1plydrop[i2 * 256 + i1] |= (1u << SKY);
+					tbl[i2 * 256 + i1] |= (1u << SKY);
 				}
 				// 荁FΏۊO
 				// (DIR01  DIR02  DIR03 ȊOɓȂƋl))
 				if ((i2 & ~(KIKI01 | KIKI02 | KIKI03)) == 0) {
-					TblMate1plydrop[i2 * 256 + i1] |= (1u << SGI);
+					tbl[i2 * 256 + i1] |= (1u << SGI);
 				}
 				// ͑ΏۊO
 				// (DIR01  DIR02  DIR03  DIR06  DIR07 ȊOɓȂƋl))
 				if ((i2 & ~(KIKI01 | KIKI02 | KIKI03 | KIKI06 | KIKI07)) == 0) {
-					TblMate1plydrop[i2 * 256 + i1] |= (1u << SKI)
+					tbl[i2 * 256 + i1] |= (1u << SKI)
 						| (1u << STO) | (1u << SNY) | (1u << SNK) | (1u << SNG);
 				}
 				// (DIR01  DIR06  DIR07 ȊOɓȂƋl))
 				if ((i2 & ~(KIKI01 | KIKI06 | KIKI07)) == 0) {
-					TblMate1plydrop[i2 * 256 + i1] |= (1 << GKI)
+					tbl[i2 * 256 + i1] |= (1 << GKI)
 						| (1u << GTO) | (1u << GNY) | (1u << GNK) | (1u << GNG);
 				}
 				// p͑ΏۊO
 				// (DIR00, DIR01, DIR06, DIR07 ȊOɓȂƋl)
 				if ((i2 & ~(KIKI00 | KIKI01 | KIKI06 | KIKI07)) == 0) {
-					TblMate1plydrop[i2 * 256 + i1] |= (1u << SHI) | (1u << GHI);
+					tbl[i2 * 256 + i1] |= (1u << SHI) | (1u << GHI);
 				}
 				// n(DIR01, DIR02, DIR03, DIR06, DIR07 ȊOɓȂƋl)
 				if ((i2 & ~(KIKI01 | KIKI02 | KIKI03 | KIKI06 | KIKI07)) == 0) {
-					TblMate1plydrop[i2 * 256 + i1] |= (1u << SUM) | (1u << GUM);
+					tbl[i2 * 256 + i1] |= (1u << SUM) | (1u << GUM);
 				}
 				// (DIR00, DIR01, DIR02, DIR03, DIR06, DIR07 ȊOɓȂƋl)
 				if ((i2 & ~(KIKI00 | KIKI01 | KIKI02 | KIKI03 | KIKI06 | KIKI07)) == 0) {
-					TblMate1plydrop[i2 * 256 + i1] |= (1u << SRY) | (1u << GRY);
+					tbl[i2 * 256 + i1] |= (1u << SRY) | (1u << GRY);
 				}
 			}
 			if (i1 & KIKI02) {
@@ -150,26 +152,26 @@ void Position::initMate1ply()
 				// ͑ΏۊO
 				// (DIR00, DIR02, DIR04, DIR06ȊOɓȂƋl)
 				if ((i2 & ~(KIKI00 | KIKI02 | KIKI04 | KIKI06)) == 0) {
-					TblMate1plydrop[i2 * 256 + i1] |= (1u << SKI)
+					tbl[i2 * 256 + i1] |= (1u << SKI)
 						| (1u << STO) | (1u << SNY) | (1u << SNK) | (1u << SNG);
 				}
 				// (DIR01, DIR02, DIR04, DIR06ȊOɓȂƋl)
 				if ((i2 & ~(KIKI01 | KIKI02 | KIKI04 | KIKI06)) == 0) {
-					TblMate1plydrop[i2 * 256 + i1] |= (1u << GKI)
+					tbl[i2 * 256 + i1] |= (1u << GKI)
 						| (1u << GTO) | (1u << GNY) | (1u << GNK) | (1u << GNG);
 				}
 				// p͑ΏۊO
 				// (DIR02, DIR03, DIR04, DIR06 ȊOɓȂƋl)
 				if ((i2 & ~(KIKI02 | KIKI03 | KIKI04 | KIKI06)) == 0) {
-					TblMate1plydrop[i2 * 256 + i1] |= (1u << SHI) | (1u << GHI);
+					tbl[i2 * 256 + i1] |= (1u << SHI) | (1u << GHI);
 				}
 				// n(DIR00, DIR01, DIR02, DIR04, DIR06 ȊOɓȂƋl)
 				if ((i2 & ~(KIKI00 | KIKI01 | KIKI02 | KIKI04 | KIKI06)) == 0) {
-					TblMate1plydrop[i2 * 256 + i1] |= (1u << SUM) | (1u << GUM);
+					tbl[i2 * 256 + i1] |= (1u << SUM) | (1u << GUM);
 				}
 				// (DIR00, DIR01, DIR02, DIR03, DIR04, DIR06 ȊOɓȂƋl)
 				if ((i2 & ~(KIKI00 | KIKI01 | KIKI02 | KIKI03 | KIKI04 | KIKI06)) == 0) {
-					TblMate1plydrop[i2 * 256 + i1] |= (1u << SRY) | (1u << GRY);
+					tbl[i2 * 256 + i1] |= (1u << SRY) | (1u << GRY);
 				}
 			}
 			if (i1 & KIKI03) {
@@ -179,26 +181,26 @@ void Position::initMate1ply()
 				// ͑ΏۊO
 				// (DIR00, DIR03, DIR05, DIR07ȊOɓȂƋl)
 				if ((i2 & ~(KIKI00 | KIKI03 | KIKI05 | KIKI07)) == 0) {
-					TblMate1plydrop[i2 * 256 + i1] |= (1u << SKI)
+					tbl[i2 * 256 + i1] |= (1u << SKI)
 						| (1u << STO) | (1u << SNY) | (1u << SNK) | (1u << SNG);
 				}
 				// (DIR01, DIR03, DIR05, DIR07ȊOɓȂƋl)
 				if ((i2 & ~(KIKI01 | KIKI03 | KIKI05 | KIKI07)) == 0) {
-					TblMate1plydrop[i2 * 256 + i1] |= (1u << GKI)
+					tbl[i2 * 256 + i1] |= (1u << GKI)
 						| (1u << GTO) | (1u << GNY) | (1u << GNK) | (1u << GNG);
 				}
 				// p͑ΏۊO
 				// (DIR02, DIR03, DIR05, DIR07 ȊOɓȂƋl)
 				if ((i2 & ~(KIKI02 | KIKI03 | KIKI05 | KIKI07)) == 0) {
-					TblMate1plydrop[i2 * 256 + i1] |= (1u << SHI) | (1u << GHI);
+					tbl[i2 * 256 + i1] |= (1u << SHI) | (1u << GHI);
 				}
 				// n(DIR00, DIR01, DIR03, DIR05, DIR07 ȊOɓȂƋl)
 				if ((i2 & ~(KIKI00 | KIKI01 | KIKI03 | KIKI05 | KIKI07)) == 0) {
-					TblMate1plydrop[i2 * 256 + i1] |= (1u << SUM) | (1u << GUM);
+					tbl[i2 * 256 + i1] |= (1u << SUM) | (1u << GUM);
 				}
 				// (DIR00, DIR01, DIR02, DIR03, DIR05, DIR07 ȊOɓȂƋl)
 				if ((i2 & ~(KIKI00 | KIKI01 | KIKI02 | KIKI03 | KIKI05 | KIKI07)) == 0) {
-					TblMate1plydrop[i2 * 256 + i1] |= (1u << SRY) | (1u << GRY);
+					tbl[i2 * 256 + i1] |= (1u << SRY) | (1u << GRY);
 				}
 			}
 			if (i1 & KIKI04) {
@@ -206,30 +208,30 @@ void Position::initMate1ply()
 				// 荁͑ΏۊO
 				// (DIR04 ȊOɓȂƋl)
 				if ((i2 & ~(KIKI04)) == 0) {
-					TblMate1plydrop[i2 * 256 + i1] |= (1u << SGI);
+					tbl[i2 * 256 + i1] |= (1u << SGI);
 				}
 				// (DIR02, DIR04 ȊOɓȂƋl)
 				if ((i2 & ~(KIKI02 | KIKI04)) == 0) {
-					TblMate1plydrop[i2 * 256 + i1] |= (1u << GGI);
+					tbl[i2 * 256 + i1] |= (1u << GGI);
 				}
 				// ͑ΏۊO
 				// (DIR00, DIR02, DIR04 ȊOɓȂƋl)
 				if ((i2 & ~(KIKI00 | KIKI02 | KIKI04)) == 0) {
-					TblMate1plydrop[i2 * 256 + i1] |= (1u << GKI)
+					tbl[i2 * 256 + i1] |= (1u << GKI)
 						| (1u << GTO) | (1u << GNY) | (1u << GNK) | (1u << GNG);
 				}
 				// p(DIR04  DIR07 ȊOɓȂƋl)
 				if ((i2 & ~(KIKI04 | KIKI07)) == 0) {
-					TblMate1plydrop[i2 * 256 + i1] |= (1u << SKA) | (1u << GKA);
+					tbl[i2 * 256 + i1] |= (1u << SKA) | (1u << GKA);
 				}
 				// ͑ΏۊO
 				// n(DIR00, DIR02, DIR04  DIR07 ȊOɓȂƋl)
 				if ((i2 & ~(KIKI00 | KIKI02 | KIKI04 | KIKI07)) == 0) {
-					TblMate1plydrop[i2 * 256 + i1] |= (1u << SUM) | (1u << GUM);
+					tbl[i2 * 256 + i1] |= (1u << SUM) | (1u << GUM);
 				}
 				// (DIR00, DIR02, DIR04, DIR05, DIR06 ȊOɓȂƋl)
 				if ((i2 & ~(KIKI00 | KIKI02 | KIKI04 | KIKI05 | KIKI06)) == 0) {
-					TblMate1plydrop[i2 * 256 + i1] |= (1u << SRY) | (1u << GRY);
+					tbl[i2 * 256 + i1] |= (1u << SRY) | (1u << GRY);
 				}
 			}
 			if (i1 & KIKI05) {
@@ -237,30 +239,30 @@ void Position::initMate1ply()
 				// 荁͑ΏۊO
 				// (DIR05 ȊOɓȂƋl)
 				if ((i2 & ~(KIKI05)) == 0) {
-					TblMate1plydrop[i2 * 256 + i1] |= (1u << SGI);
+					tbl[i2 * 256 + i1] |= (1u << SGI);
 				}
 				// (DIR03, DIR05 ȊOɓȂƋl)
 				if ((i2 & ~(KIKI03 | KIKI05)) == 0) {
-					TblMate1plydrop[i2 * 256 + i1] |= (1u << GGI);
+					tbl[i2 * 256 + i1] |= (1u << GGI);
 				}
 				// ͑ΏۊO
 				// (DIR00, DIR03, DIR05 ȊOɓȂƋl)
 				if ((i2 & ~(KIKI00 | KIKI03 | KIKI05)) == 0) {
-					TblMate1plydrop[i2 * 256 + i1] |= (1u << GKI)
+					tbl[i2 * 256 + i1] |= (1u << GKI)
 						| (1u << GTO) | (1u << GNY) | (1u << GNK) | (1u << GNG);
 				}
 				// p(DIR05  DIR06 ȊOɓȂƋl)
 				if ((i2 & ~(KIKI05 | KIKI06)) == 0) {
-					TblMate1plydrop[i2 * 256 + i1] |= (1u << SKA) | (1u << GKA);
+					tbl[i2 * 256 + i1] |= (1u << SKA) | (1u << GKA);
 				}
 				// ͑ΏۊO
 				// n(DIR00, DIR03, DIR05  DIR06 ȊOɓȂƋl)
 				if ((i2 & ~(KIKI00 | KIKI03 | KIKI05 | KIKI06)) == 0) {
-					TblMate1plydrop[i2 * 256 + i1] |= (1u << SUM) | (1u << GUM);
+					tbl[i2 * 256 + i1] |= (1u << SUM) | (1u << GUM);
 				}
 				// (DIR00, DIR03, DIR04, DIR05, DIR07 ȊOɓȂƋl)
 				if ((i2 & ~(KIKI00 | KIKI03 | KIKI04 | KIKI05 | KIKI07)) == 0) {
-					TblMate1plydrop[i2 * 256 + i1] |= (1u << SRY) | (1u << GRY);
+					tbl[i2 * 256 + i1] |= (1u << SRY) | (1u << GRY);
 				}
 			}
 			if (i1 & KIKI06) {
@@ -268,30 +270,30 @@ void Position::initMate1ply()
 				// 荁͑ΏۊO
 				// (DIR02, DIR06 ȊOɓȂƋl)
 				if ((i2 & ~(KIKI02 | KIKI06)) == 0) {
-					TblMate1plydrop[i2 * 256 + i1] |= (1u << SGI);
+					tbl[i2 * 256 + i1] |= (1u << SGI);
 				}
 				// (DIR06 ȊOɓȂƋl)
 				if ((i2 & ~(KIKI06)) == 0) {
-					TblMate1plydrop[i2 * 256 + i1] |= (1u << GGI);
+					tbl[i2 * 256 + i1] |= (1u << GGI);
 				}
 				// (DIR01  DIR02  DIR06 ȊOɓȂƋl)
 				if ((i2 & ~(KIKI01 | KIKI02 | KIKI06)) == 0) {
-					TblMate1plydrop[i2 * 256 + i1] |= (1u << SKI)
+					tbl[i2 * 256 + i1] |= (1u << SKI)
 						| (1u << STO) | (1u << SNY) | (1u << SNK) | (1u << SNG);
 				}
 				// ͑ΏۊO
 				// p(DIR05  DIR06 ȊOɓȂƋl)
 				if ((i2 & ~(KIKI05 | KIKI06)) == 0) {
-					TblMate1plydrop[i2 * 256 + i1] |= (1u << SKA) | (1u << GKA);
+					tbl[i2 * 256 + i1] |= (1u << SKA) | (1u << GKA);
 				}
 				// ͑ΏۊO
 				// n(DIR01, DIR02, DIR05  DIR06 ȊOɓȂƋl)
 				if ((i2 & ~(KIKI01 | KIKI02 | KIKI05 | KIKI06)) == 0) {
-					TblMate1plydrop[i2 * 256 + i1] |= (1u << SUM) | (1u << GUM);
+					tbl[i2 * 256 + i1] |= (1u << SUM) | (1u << GUM);
 				}
 				// (DIR01, DIR02, DIR04, DIR06  DIR07 ȊOɓȂƋl)
 				if ((i2 & ~(KIKI01 | KIKI02 | KIKI04 | KIKI06 | KIKI07)) == 0) {
-					TblMate1plydrop[i2 * 256 + i1] |= (1u << SRY) | (1u << GRY);
+					tbl[i2 * 256 + i1] |= (1u << SRY) | (1u << GRY);
 				}
 			}
 			if (i1 & KIKI07) {
@@ -299,34 +301,103 @@ void Position::initMate1ply()
 				// 荁͑ΏۊO
 				// (DIR03, DIR07 ȊOɓȂƋl)
 				if ((i2 & ~(KIKI03 | KIKI07)) == 0) {
-					TblMate1plydrop[i2 * 256 + i1] |= (1u << SGI);
+					tbl[i2 * 256 + i1] |= (1u << SGI);
 				}
 				// (DIR07 ȊOɓȂƋl)
 				if ((i2 & ~(KIKI07)) == 0) {
-					TblMate1plydrop[i2 * 256 + i1] |= (1u << GGI);
+					tbl[i2 * 256 + i1] |= (1u << GGI);
 				}
 				// (DIR01  DIR03  DIR07 ȊOɓȂƋl)
 				if ((i2 & ~(KIKI01 | KIKI03 | KIKI07)) == 0) {
-					TblMate1plydrop[i2 * 256 + i1] |= (1u << SKI)
+					tbl[i2 * 256 + i1] |= (1u << SKI)
 						| (1u << STO) | (1u << SNY) | (1u << SNK) | (1u << SNG);
 				}
 				// ͑ΏۊO
 				// p(DIR04  DIR07 ȊOɓȂƋl)
 				if ((i2 & ~(KIKI04 | KIKI07)) == 0) {
-					TblMate1plydrop[i2 * 256 + i1] |= (1u << SKA) | (1u << GKA);
+					tbl[i2 * 256 + i1] |= (1u << SKA) | (1u << GKA);
 				}
 				// ͑ΏۊO
 				// n(DIR01, DIR03, DIR04  DIR07 ȊOɓȂƋl)
 				if ((i2 & ~(KIKI01 | KIKI03 | KIKI04 | KIKI07)) == 0) {
-					TblMate1plydrop[i2 * 256 + i1] |= (1u << SUM) | (1u << GUM);
+					tbl[i2 * 256 + i1] |= (1u << SUM) | (1u << GUM);
 				}
 				// (DIR01, DIR03, DIR05, DIR06, DIR07 ȊOɓȂƋl)
 				if ((i2 & ~(KIKI01 | KIKI03 | KIKI05 | KIKI06 | KIKI07)) == 0) {
-					TblMate1plydrop[i2 * 256 + i1] |= (1u << SRY) | (1u << GRY);
+					tbl[i2 * 256 + i1] |= (1u << SRY) | (1u << GRY);
 				}
 			}
 		}
 	}
+}
+
+// Տ2_Ԃ̕(Position::DirTbl[from][to])
+static void makeDirTbl(unsigned char tbl[0xA0][0x100])
+{
+	int from;
+	int to;
+	int i;
+	memset(tbl, 0, sizeof(unsigned char) * 0xA0 * 0x100);
+	for (from = 0x11; from <= 0x99; from++) {
+		if ((from & 0x0F) == 0 || (from & 0x0F) > 9) continue;
+		for (i = 0; i < 8; i++) {
+			int dir = NanohaTbl::Direction[i];
+			to = from;
+			while (1) {
+				to += dir;
+				if ((to & 0x0F) == 0 || (to & 0x0F) >    9) break;
+				if ((to & 0xF0) == 0 || (to & 0xF0) > 0x90) break;
+				tbl[from][to] = (unsigned char)(1 << i);
+			}
+		}
+	}
+}
+#endif
+
+#if defined(GEN_STATIC_TABLES)
+// mate1ply_tbl.h o(-DGEN_STATIC_TABLES ŃrhċNƍ蒼)
+static void writeStaticTables(const uint32_t drop[0x10000], const unsigned char dir[0xA0][0x100])
+{
+	FILE *fp = fopen("mate1ply_tbl.h", "w");
+	if (fp == NULL) return;
+	fprintf(fp, "// ̃t@C mate1ply.cpp  -DGEN_STATIC_TABLES ŃrhĐ. ŕҏWȂ.\n");
+	fprintf(fp, "// Nɕ\炸ɍς݁Aǂݍݐpy[WƂăvZXԂŋL.\n\n");
+	fprintf(fp, "const unsigned char Position::DirTbl[0xA0][0x100] = {\n");
+	for (int from = 0; from < 0xA0; from++) {
+		fprintf(fp, "\t{");
+		for (int to = 0; to < 0x100; to++) {
+			fprintf(fp, "%s%u,", (to % 32 == 0) ? (to ? "\n\t " : "") : "", dir[from][to]);
+		}
+		fprintf(fp, "},\n");
+	}
+	fprintf(fp, "};\n\n");
+	fprintf(fp, "const uint32_t Position::TblMate1plydrop[0x10000] = {\n");
+	for (int i = 0; i < 0x10000; i++) {
+		fprintf(fp, "%s0x%08X,%s", (i % 8 == 0) ? "\t" : "", drop[i], (i % 8 == 7) ? "\n" : "");
+	}
+	fprintf(fp, "};\n");
+	fclose(fp);
+}
+#endif
+
+// \
+//  TblMate1plydrop[]  DirTbl[] ̓rhɐς(mate1ply_tbl.h)Ȃ̂ŁA
+//  ł̓fobOrhŐƈv邩mF邾.
+void Position::initMate1ply()
+{
+#if !defined(NDEBUG) || defined(GEN_STATIC_TABLES)
+	{
+		static uint32_t drop[0x10000];
+		static unsigned char dir[0xA0][0x100];
+		makeTblMate1plydrop(drop);
+		makeDirTbl(dir);
+#if defined(GEN_STATIC_TABLES)
+		writeStaticTables(drop, dir);
+#endif
+		assert(memcmp(drop, TblMate1plydrop, sizeof(drop)) == 0);
+		assert(memcmp(dir, DirTbl, sizeof(dir)) == 0);
+	}
+#endif
 
 	// ̒`
 	//  Dir05 Dir00 Dir04
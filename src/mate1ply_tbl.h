@@ -0,0 +1,9480 @@
+// ̃t@C mate1ply.cpp  -DGEN_STATIC_TABLES ŃrhĐ. ŕҏWȂ.
+// Nɕ\炸ɍς݁Aǂݍݐpy[WƂăvZXԂŋL.
+
+const unsigned char Position::DirTbl[0xA0][0x100] = {
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,2,2,2,2,2,2,2,0,0,0,0,0,0,
+	 0,8,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,0,128,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,8,0,0,128,0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,128,0,0,0,0,0,0,0,0,0,0,
+	 0,8,0,0,0,0,128,0,0,0,0,0,0,0,0,0,0,8,0,0,0,0,0,128,0,0,0,0,0,0,0,0,
+	 0,8,0,0,0,0,0,0,128,0,0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,128,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,2,2,2,2,2,2,2,0,0,0,0,0,0,
+	 0,32,8,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,0,128,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,8,0,0,128,0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,128,0,0,0,0,0,0,0,0,0,
+	 0,0,8,0,0,0,0,128,0,0,0,0,0,0,0,0,0,0,8,0,0,0,0,0,128,0,0,0,0,0,0,0,
+	 0,0,8,0,0,0,0,0,0,128,0,0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,2,2,2,2,2,2,0,0,0,0,0,0,
+	 0,0,32,8,128,0,0,0,0,0,0,0,0,0,0,0,0,32,0,8,0,128,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,8,0,0,128,0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,128,0,0,0,0,0,0,0,0,
+	 0,0,0,8,0,0,0,0,128,0,0,0,0,0,0,0,0,0,0,8,0,0,0,0,0,128,0,0,0,0,0,0,
+	 0,0,0,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,2,2,2,2,2,0,0,0,0,0,0,
+	 0,0,0,32,8,128,0,0,0,0,0,0,0,0,0,0,0,0,32,0,8,0,128,0,0,0,0,0,0,0,0,0,
+	 0,32,0,0,8,0,0,128,0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,128,0,0,0,0,0,0,0,
+	 0,0,0,0,8,0,0,0,0,128,0,0,0,0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,2,2,2,2,0,0,0,0,0,0,
+	 0,0,0,0,32,8,128,0,0,0,0,0,0,0,0,0,0,0,0,32,0,8,0,128,0,0,0,0,0,0,0,0,
+	 0,0,32,0,0,8,0,0,128,0,0,0,0,0,0,0,0,32,0,0,0,8,0,0,0,128,0,0,0,0,0,0,
+	 0,0,0,0,0,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,2,2,2,0,0,0,0,0,0,
+	 0,0,0,0,0,32,8,128,0,0,0,0,0,0,0,0,0,0,0,0,32,0,8,0,128,0,0,0,0,0,0,0,
+	 0,0,0,32,0,0,8,0,0,128,0,0,0,0,0,0,0,0,32,0,0,0,8,0,0,0,0,0,0,0,0,0,
+	 0,32,0,0,0,0,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,2,2,0,0,0,0,0,0,
+	 0,0,0,0,0,0,32,8,128,0,0,0,0,0,0,0,0,0,0,0,0,32,0,8,0,128,0,0,0,0,0,0,
+	 0,0,0,0,32,0,0,8,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,8,0,0,0,0,0,0,0,0,
+	 0,0,32,0,0,0,0,8,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,8,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,0,2,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,32,8,128,0,0,0,0,0,0,0,0,0,0,0,0,32,0,8,0,0,0,0,0,0,0,
+	 0,0,0,0,0,32,0,0,8,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,8,0,0,0,0,0,0,0,
+	 0,0,0,32,0,0,0,0,8,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,8,0,0,0,0,0,0,0,
+	 0,32,0,0,0,0,0,0,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,32,8,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,8,0,0,0,0,0,0,
+	 0,0,0,0,0,0,32,0,0,8,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,8,0,0,0,0,0,0,
+	 0,0,0,0,32,0,0,0,0,8,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,8,0,0,0,0,0,0,
+	 0,0,32,0,0,0,0,0,0,8,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,8,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,64,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,2,2,2,2,2,2,2,2,0,0,0,0,0,0,0,8,128,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,8,0,128,0,0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,128,0,0,0,0,0,0,0,0,0,0,0,
+	 0,8,0,0,0,128,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,0,128,0,0,0,0,0,0,0,0,0,
+	 0,8,0,0,0,0,0,128,0,0,0,0,0,0,0,0,0,8,0,0,0,0,0,0,128,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,4,64,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,1,0,2,2,2,2,2,2,2,0,0,0,0,0,0,0,32,8,128,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,8,0,128,0,0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,128,0,0,0,0,0,0,0,0,0,0,
+	 0,0,8,0,0,0,128,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,0,128,0,0,0,0,0,0,0,0,
+	 0,0,8,0,0,0,0,0,128,0,0,0,0,0,0,0,0,0,8,0,0,0,0,0,0,128,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,4,64,0,0,0,0,0,0,0,0,0,0,0,
+	 0,1,1,0,2,2,2,2,2,2,0,0,0,0,0,0,0,0,32,8,128,0,0,0,0,0,0,0,0,0,0,0,
+	 0,32,0,8,0,128,0,0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,128,0,0,0,0,0,0,0,0,0,
+	 0,0,0,8,0,0,0,128,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,0,128,0,0,0,0,0,0,0,
+	 0,0,0,8,0,0,0,0,0,128,0,0,0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,4,64,0,0,0,0,0,0,0,0,0,0,
+	 0,1,1,1,0,2,2,2,2,2,0,0,0,0,0,0,0,0,0,32,8,128,0,0,0,0,0,0,0,0,0,0,
+	 0,0,32,0,8,0,128,0,0,0,0,0,0,0,0,0,0,32,0,0,8,0,0,128,0,0,0,0,0,0,0,0,
+	 0,0,0,0,8,0,0,0,128,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,0,128,0,0,0,0,0,0,
+	 0,0,0,0,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,4,64,0,0,0,0,0,0,0,0,0,
+	 0,1,1,1,1,0,2,2,2,2,0,0,0,0,0,0,0,0,0,0,32,8,128,0,0,0,0,0,0,0,0,0,
+	 0,0,0,32,0,8,0,128,0,0,0,0,0,0,0,0,0,0,32,0,0,8,0,0,128,0,0,0,0,0,0,0,
+	 0,32,0,0,0,8,0,0,0,128,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,4,64,0,0,0,0,0,0,0,0,
+	 0,1,1,1,1,1,0,2,2,2,0,0,0,0,0,0,0,0,0,0,0,32,8,128,0,0,0,0,0,0,0,0,
+	 0,0,0,0,32,0,8,0,128,0,0,0,0,0,0,0,0,0,0,32,0,0,8,0,0,128,0,0,0,0,0,0,
+	 0,0,32,0,0,0,8,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,8,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,4,64,0,0,0,0,0,0,0,
+	 0,1,1,1,1,1,1,0,2,2,0,0,0,0,0,0,0,0,0,0,0,0,32,8,128,0,0,0,0,0,0,0,
+	 0,0,0,0,0,32,0,8,0,128,0,0,0,0,0,0,0,0,0,0,32,0,0,8,0,0,0,0,0,0,0,0,
+	 0,0,0,32,0,0,0,8,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,8,0,0,0,0,0,0,0,0,
+	 0,32,0,0,0,0,0,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,4,64,0,0,0,0,0,0,
+	 0,1,1,1,1,1,1,1,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,32,8,128,0,0,0,0,0,0,
+	 0,0,0,0,0,0,32,0,8,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,8,0,0,0,0,0,0,0,
+	 0,0,0,0,32,0,0,0,8,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,8,0,0,0,0,0,0,0,
+	 0,0,32,0,0,0,0,0,8,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,8,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,4,0,0,0,0,0,0,
+	 0,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,8,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,32,0,8,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,8,0,0,0,0,0,0,
+	 0,0,0,0,0,32,0,0,0,8,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,8,0,0,0,0,0,0,
+	 0,0,0,32,0,0,0,0,0,8,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,8,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,64,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,4,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,2,2,2,2,2,2,2,0,0,0,0,0,0,
+	 0,8,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,0,128,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,8,0,0,128,0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,128,0,0,0,0,0,0,0,0,0,0,
+	 0,8,0,0,0,0,128,0,0,0,0,0,0,0,0,0,0,8,0,0,0,0,0,128,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,64,0,0,0,0,0,0,0,0,0,0,0,
+	 0,16,4,64,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,2,2,2,2,2,2,2,0,0,0,0,0,0,
+	 0,32,8,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,0,128,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,8,0,0,128,0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,128,0,0,0,0,0,0,0,0,0,
+	 0,0,8,0,0,0,0,128,0,0,0,0,0,0,0,0,0,0,8,0,0,0,0,0,128,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,4,0,64,0,0,0,0,0,0,0,0,0,0,
+	 0,0,16,4,64,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,2,2,2,2,2,2,0,0,0,0,0,0,
+	 0,0,32,8,128,0,0,0,0,0,0,0,0,0,0,0,0,32,0,8,0,128,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,8,0,0,128,0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,128,0,0,0,0,0,0,0,0,
+	 0,0,0,8,0,0,0,0,128,0,0,0,0,0,0,0,0,0,0,8,0,0,0,0,0,128,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,4,0,64,0,0,0,0,0,0,0,0,0,
+	 0,0,0,16,4,64,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,2,2,2,2,2,0,0,0,0,0,0,
+	 0,0,0,32,8,128,0,0,0,0,0,0,0,0,0,0,0,0,32,0,8,0,128,0,0,0,0,0,0,0,0,0,
+	 0,32,0,0,8,0,0,128,0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,128,0,0,0,0,0,0,0,
+	 0,0,0,0,8,0,0,0,0,128,0,0,0,0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,4,0,64,0,0,0,0,0,0,0,0,
+	 0,0,0,0,16,4,64,0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,2,2,2,2,0,0,0,0,0,0,
+	 0,0,0,0,32,8,128,0,0,0,0,0,0,0,0,0,0,0,0,32,0,8,0,128,0,0,0,0,0,0,0,0,
+	 0,0,32,0,0,8,0,0,128,0,0,0,0,0,0,0,0,32,0,0,0,8,0,0,0,128,0,0,0,0,0,0,
+	 0,0,0,0,0,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,4,0,64,0,0,0,0,0,0,0,
+	 0,0,0,0,0,16,4,64,0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,2,2,2,0,0,0,0,0,0,
+	 0,0,0,0,0,32,8,128,0,0,0,0,0,0,0,0,0,0,0,0,32,0,8,0,128,0,0,0,0,0,0,0,
+	 0,0,0,32,0,0,8,0,0,128,0,0,0,0,0,0,0,0,32,0,0,0,8,0,0,0,0,0,0,0,0,0,
+	 0,32,0,0,0,0,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,4,0,64,0,0,0,0,0,0,
+	 0,0,0,0,0,0,16,4,64,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,2,2,0,0,0,0,0,0,
+	 0,0,0,0,0,0,32,8,128,0,0,0,0,0,0,0,0,0,0,0,0,32,0,8,0,128,0,0,0,0,0,0,
+	 0,0,0,0,32,0,0,8,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,8,0,0,0,0,0,0,0,0,
+	 0,0,32,0,0,0,0,8,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,8,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,4,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,16,4,64,0,0,0,0,0,0,0,1,1,1,1,1,1,1,0,2,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,32,8,128,0,0,0,0,0,0,0,0,0,0,0,0,32,0,8,0,0,0,0,0,0,0,
+	 0,0,0,0,0,32,0,0,8,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,8,0,0,0,0,0,0,0,
+	 0,0,0,32,0,0,0,0,8,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,8,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,4,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,16,4,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,32,8,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,8,0,0,0,0,0,0,
+	 0,0,0,0,0,0,32,0,0,8,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,8,0,0,0,0,0,0,
+	 0,0,0,0,32,0,0,0,0,8,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,8,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,64,0,0,0,0,0,0,0,0,0,0,0,
+	 0,4,0,64,0,0,0,0,0,0,0,0,0,0,0,0,0,4,64,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,2,2,2,2,2,2,2,2,0,0,0,0,0,0,0,8,128,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,8,0,128,0,0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,128,0,0,0,0,0,0,0,0,0,0,0,
+	 0,8,0,0,0,128,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,0,128,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,64,0,0,0,0,0,0,0,0,0,0,
+	 0,0,4,0,64,0,0,0,0,0,0,0,0,0,0,0,0,16,4,64,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,1,0,2,2,2,2,2,2,2,0,0,0,0,0,0,0,32,8,128,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,8,0,128,0,0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,128,0,0,0,0,0,0,0,0,0,0,
+	 0,0,8,0,0,0,128,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,0,128,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,64,0,0,0,0,0,0,0,0,0,
+	 0,16,0,4,0,64,0,0,0,0,0,0,0,0,0,0,0,0,16,4,64,0,0,0,0,0,0,0,0,0,0,0,
+	 0,1,1,0,2,2,2,2,2,2,0,0,0,0,0,0,0,0,32,8,128,0,0,0,0,0,0,0,0,0,0,0,
+	 0,32,0,8,0,128,0,0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,128,0,0,0,0,0,0,0,0,0,
+	 0,0,0,8,0,0,0,128,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,0,128,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,4,0,0,64,0,0,0,0,0,0,0,0,
+	 0,0,16,0,4,0,64,0,0,0,0,0,0,0,0,0,0,0,0,16,4,64,0,0,0,0,0,0,0,0,0,0,
+	 0,1,1,1,0,2,2,2,2,2,0,0,0,0,0,0,0,0,0,32,8,128,0,0,0,0,0,0,0,0,0,0,
+	 0,0,32,0,8,0,128,0,0,0,0,0,0,0,0,0,0,32,0,0,8,0,0,128,0,0,0,0,0,0,0,0,
+	 0,0,0,0,8,0,0,0,128,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,0,128,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,4,0,0,64,0,0,0,0,0,0,0,
+	 0,0,0,16,0,4,0,64,0,0,0,0,0,0,0,0,0,0,0,0,16,4,64,0,0,0,0,0,0,0,0,0,
+	 0,1,1,1,1,0,2,2,2,2,0,0,0,0,0,0,0,0,0,0,32,8,128,0,0,0,0,0,0,0,0,0,
+	 0,0,0,32,0,8,0,128,0,0,0,0,0,0,0,0,0,0,32,0,0,8,0,0,128,0,0,0,0,0,0,0,
+	 0,32,0,0,0,8,0,0,0,128,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,4,0,0,64,0,0,0,0,0,0,
+	 0,0,0,0,16,0,4,0,64,0,0,0,0,0,0,0,0,0,0,0,0,16,4,64,0,0,0,0,0,0,0,0,
+	 0,1,1,1,1,1,0,2,2,2,0,0,0,0,0,0,0,0,0,0,0,32,8,128,0,0,0,0,0,0,0,0,
+	 0,0,0,0,32,0,8,0,128,0,0,0,0,0,0,0,0,0,0,32,0,0,8,0,0,128,0,0,0,0,0,0,
+	 0,0,32,0,0,0,8,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,8,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,4,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,16,0,4,0,64,0,0,0,0,0,0,0,0,0,0,0,0,16,4,64,0,0,0,0,0,0,0,
+	 0,1,1,1,1,1,1,0,2,2,0,0,0,0,0,0,0,0,0,0,0,0,32,8,128,0,0,0,0,0,0,0,
+	 0,0,0,0,0,32,0,8,0,128,0,0,0,0,0,0,0,0,0,0,32,0,0,8,0,0,0,0,0,0,0,0,
+	 0,0,0,32,0,0,0,8,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,8,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,4,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,16,0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,4,64,0,0,0,0,0,0,
+	 0,1,1,1,1,1,1,1,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,32,8,128,0,0,0,0,0,0,
+	 0,0,0,0,0,0,32,0,8,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,8,0,0,0,0,0,0,0,
+	 0,0,0,0,32,0,0,0,8,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,8,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,4,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,16,0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,4,0,0,0,0,0,0,
+	 0,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,8,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,32,0,8,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,8,0,0,0,0,0,0,
+	 0,0,0,0,0,32,0,0,0,8,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,8,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,64,0,0,0,0,0,0,0,0,0,0,
+	 0,4,0,0,64,0,0,0,0,0,0,0,0,0,0,0,0,4,0,64,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,4,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,2,2,2,2,2,2,2,0,0,0,0,0,0,
+	 0,8,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,0,128,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,8,0,0,128,0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,128,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,64,0,0,0,0,0,0,0,0,0,
+	 0,0,4,0,0,64,0,0,0,0,0,0,0,0,0,0,0,0,4,0,64,0,0,0,0,0,0,0,0,0,0,0,
+	 0,16,4,64,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,2,2,2,2,2,2,2,0,0,0,0,0,0,
+	 0,32,8,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,0,128,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,8,0,0,128,0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,128,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,64,0,0,0,0,0,0,0,0,
+	 0,0,0,4,0,0,64,0,0,0,0,0,0,0,0,0,0,16,0,4,0,64,0,0,0,0,0,0,0,0,0,0,
+	 0,0,16,4,64,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,2,2,2,2,2,2,0,0,0,0,0,0,
+	 0,0,32,8,128,0,0,0,0,0,0,0,0,0,0,0,0,32,0,8,0,128,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,8,0,0,128,0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,128,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,64,0,0,0,0,0,0,0,
+	 0,16,0,0,4,0,0,64,0,0,0,0,0,0,0,0,0,0,16,0,4,0,64,0,0,0,0,0,0,0,0,0,
+	 0,0,0,16,4,64,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,2,2,2,2,2,0,0,0,0,0,0,
+	 0,0,0,32,8,128,0,0,0,0,0,0,0,0,0,0,0,0,32,0,8,0,128,0,0,0,0,0,0,0,0,0,
+	 0,32,0,0,8,0,0,128,0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,128,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,4,0,0,0,64,0,0,0,0,0,0,
+	 0,0,16,0,0,4,0,0,64,0,0,0,0,0,0,0,0,0,0,16,0,4,0,64,0,0,0,0,0,0,0,0,
+	 0,0,0,0,16,4,64,0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,2,2,2,2,0,0,0,0,0,0,
+	 0,0,0,0,32,8,128,0,0,0,0,0,0,0,0,0,0,0,0,32,0,8,0,128,0,0,0,0,0,0,0,0,
+	 0,0,32,0,0,8,0,0,128,0,0,0,0,0,0,0,0,32,0,0,0,8,0,0,0,128,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,4,0,0,0,0,0,0,0,0,0,
+	 0,0,0,16,0,0,4,0,0,64,0,0,0,0,0,0,0,0,0,0,16,0,4,0,64,0,0,0,0,0,0,0,
+	 0,0,0,0,0,16,4,64,0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,2,2,2,0,0,0,0,0,0,
+	 0,0,0,0,0,32,8,128,0,0,0,0,0,0,0,0,0,0,0,0,32,0,8,0,128,0,0,0,0,0,0,0,
+	 0,0,0,32,0,0,8,0,0,128,0,0,0,0,0,0,0,0,32,0,0,0,8,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,4,0,0,0,0,0,0,0,0,
+	 0,0,0,0,16,0,0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,4,0,64,0,0,0,0,0,0,
+	 0,0,0,0,0,0,16,4,64,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,2,2,0,0,0,0,0,0,
+	 0,0,0,0,0,0,32,8,128,0,0,0,0,0,0,0,0,0,0,0,0,32,0,8,0,128,0,0,0,0,0,0,
+	 0,0,0,0,32,0,0,8,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,8,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,4,0,0,0,0,0,0,0,
+	 0,0,0,0,0,16,0,0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,4,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,16,4,64,0,0,0,0,0,0,0,1,1,1,1,1,1,1,0,2,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,32,8,128,0,0,0,0,0,0,0,0,0,0,0,0,32,0,8,0,0,0,0,0,0,0,
+	 0,0,0,0,0,32,0,0,8,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,8,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,4,0,0,0,0,0,0,
+	 0,0,0,0,0,0,16,0,0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,4,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,16,4,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,32,8,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,8,0,0,0,0,0,0,
+	 0,0,0,0,0,0,32,0,0,8,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,8,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,0,64,0,0,0,0,0,0,0,0,0,
+	 0,4,0,0,0,64,0,0,0,0,0,0,0,0,0,0,0,4,0,0,64,0,0,0,0,0,0,0,0,0,0,0,
+	 0,4,0,64,0,0,0,0,0,0,0,0,0,0,0,0,0,4,64,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,2,2,2,2,2,2,2,2,0,0,0,0,0,0,0,8,128,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,8,0,128,0,0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,128,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,0,64,0,0,0,0,0,0,0,0,
+	 0,0,4,0,0,0,64,0,0,0,0,0,0,0,0,0,0,0,4,0,0,64,0,0,0,0,0,0,0,0,0,0,
+	 0,0,4,0,64,0,0,0,0,0,0,0,0,0,0,0,0,16,4,64,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,1,0,2,2,2,2,2,2,2,0,0,0,0,0,0,0,32,8,128,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,8,0,128,0,0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,128,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,0,64,0,0,0,0,0,0,0,
+	 0,0,0,4,0,0,0,64,0,0,0,0,0,0,0,0,0,0,0,4,0,0,64,0,0,0,0,0,0,0,0,0,
+	 0,16,0,4,0,64,0,0,0,0,0,0,0,0,0,0,0,0,16,4,64,0,0,0,0,0,0,0,0,0,0,0,
+	 0,1,1,0,2,2,2,2,2,2,0,0,0,0,0,0,0,0,32,8,128,0,0,0,0,0,0,0,0,0,0,0,
+	 0,32,0,8,0,128,0,0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,128,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,0,64,0,0,0,0,0,0,
+	 0,0,0,0,4,0,0,0,64,0,0,0,0,0,0,0,0,16,0,0,4,0,0,64,0,0,0,0,0,0,0,0,
+	 0,0,16,0,4,0,64,0,0,0,0,0,0,0,0,0,0,0,0,16,4,64,0,0,0,0,0,0,0,0,0,0,
+	 0,1,1,1,0,2,2,2,2,2,0,0,0,0,0,0,0,0,0,32,8,128,0,0,0,0,0,0,0,0,0,0,
+	 0,0,32,0,8,0,128,0,0,0,0,0,0,0,0,0,0,32,0,0,8,0,0,128,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,0,0,0,
+	 0,16,0,0,0,4,0,0,0,64,0,0,0,0,0,0,0,0,16,0,0,4,0,0,64,0,0,0,0,0,0,0,
+	 0,0,0,16,0,4,0,64,0,0,0,0,0,0,0,0,0,0,0,0,16,4,64,0,0,0,0,0,0,0,0,0,
+	 0,1,1,1,1,0,2,2,2,2,0,0,0,0,0,0,0,0,0,0,32,8,128,0,0,0,0,0,0,0,0,0,
+	 0,0,0,32,0,8,0,128,0,0,0,0,0,0,0,0,0,0,32,0,0,8,0,0,128,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,0,4,0,0,0,0,0,0,0,0,0,
+	 0,0,16,0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,4,0,0,64,0,0,0,0,0,0,
+	 0,0,0,0,16,0,4,0,64,0,0,0,0,0,0,0,0,0,0,0,0,16,4,64,0,0,0,0,0,0,0,0,
+	 0,1,1,1,1,1,0,2,2,2,0,0,0,0,0,0,0,0,0,0,0,32,8,128,0,0,0,0,0,0,0,0,
+	 0,0,0,0,32,0,8,0,128,0,0,0,0,0,0,0,0,0,0,32,0,0,8,0,0,128,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,0,4,0,0,0,0,0,0,0,0,
+	 0,0,0,16,0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,4,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,16,0,4,0,64,0,0,0,0,0,0,0,0,0,0,0,0,16,4,64,0,0,0,0,0,0,0,
+	 0,1,1,1,1,1,1,0,2,2,0,0,0,0,0,0,0,0,0,0,0,0,32,8,128,0,0,0,0,0,0,0,
+	 0,0,0,0,0,32,0,8,0,128,0,0,0,0,0,0,0,0,0,0,32,0,0,8,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,0,4,0,0,0,0,0,0,0,
+	 0,0,0,0,16,0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,4,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,16,0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,4,64,0,0,0,0,0,0,
+	 0,1,1,1,1,1,1,1,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,32,8,128,0,0,0,0,0,0,
+	 0,0,0,0,0,0,32,0,8,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,8,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,0,4,0,0,0,0,0,0,
+	 0,0,0,0,0,16,0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,4,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,16,0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,4,0,0,0,0,0,0,
+	 0,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,8,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,32,0,8,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,8,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,0,0,64,0,0,0,0,0,0,0,0,
+	 0,4,0,0,0,0,64,0,0,0,0,0,0,0,0,0,0,4,0,0,0,64,0,0,0,0,0,0,0,0,0,0,
+	 0,4,0,0,64,0,0,0,0,0,0,0,0,0,0,0,0,4,0,64,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,4,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,2,2,2,2,2,2,2,0,0,0,0,0,0,
+	 0,8,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,0,128,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,0,0,64,0,0,0,0,0,0,0,
+	 0,0,4,0,0,0,0,64,0,0,0,0,0,0,0,0,0,0,4,0,0,0,64,0,0,0,0,0,0,0,0,0,
+	 0,0,4,0,0,64,0,0,0,0,0,0,0,0,0,0,0,0,4,0,64,0,0,0,0,0,0,0,0,0,0,0,
+	 0,16,4,64,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,2,2,2,2,2,2,2,0,0,0,0,0,0,
+	 0,32,8,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,0,128,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,0,0,64,0,0,0,0,0,0,
+	 0,0,0,4,0,0,0,0,64,0,0,0,0,0,0,0,0,0,0,4,0,0,0,64,0,0,0,0,0,0,0,0,
+	 0,0,0,4,0,0,64,0,0,0,0,0,0,0,0,0,0,16,0,4,0,64,0,0,0,0,0,0,0,0,0,0,
+	 0,0,16,4,64,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,2,2,2,2,2,2,0,0,0,0,0,0,
+	 0,0,32,8,128,0,0,0,0,0,0,0,0,0,0,0,0,32,0,8,0,128,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,4,0,0,0,0,64,0,0,0,0,0,0,0,0,0,0,4,0,0,0,64,0,0,0,0,0,0,0,
+	 0,16,0,0,4,0,0,64,0,0,0,0,0,0,0,0,0,0,16,0,4,0,64,0,0,0,0,0,0,0,0,0,
+	 0,0,0,16,4,64,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,2,2,2,2,2,0,0,0,0,0,0,
+	 0,0,0,32,8,128,0,0,0,0,0,0,0,0,0,0,0,0,32,0,8,0,128,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,4,0,0,0,64,0,0,0,0,0,0,
+	 0,0,16,0,0,4,0,0,64,0,0,0,0,0,0,0,0,0,0,16,0,4,0,64,0,0,0,0,0,0,0,0,
+	 0,0,0,0,16,4,64,0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,2,2,2,2,0,0,0,0,0,0,
+	 0,0,0,0,32,8,128,0,0,0,0,0,0,0,0,0,0,0,0,32,0,8,0,128,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,0,0,
+	 0,16,0,0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,4,0,0,0,0,0,0,0,0,0,
+	 0,0,0,16,0,0,4,0,0,64,0,0,0,0,0,0,0,0,0,0,16,0,4,0,64,0,0,0,0,0,0,0,
+	 0,0,0,0,0,16,4,64,0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,2,2,2,0,0,0,0,0,0,
+	 0,0,0,0,0,32,8,128,0,0,0,0,0,0,0,0,0,0,0,0,32,0,8,0,128,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,0,0,4,0,0,0,0,0,0,0,0,
+	 0,0,16,0,0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,4,0,0,0,0,0,0,0,0,
+	 0,0,0,0,16,0,0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,4,0,64,0,0,0,0,0,0,
+	 0,0,0,0,0,0,16,4,64,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,2,2,0,0,0,0,0,0,
+	 0,0,0,0,0,0,32,8,128,0,0,0,0,0,0,0,0,0,0,0,0,32,0,8,0,128,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,0,0,4,0,0,0,0,0,0,0,
+	 0,0,0,16,0,0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,4,0,0,0,0,0,0,0,
+	 0,0,0,0,0,16,0,0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,4,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,16,4,64,0,0,0,0,0,0,0,1,1,1,1,1,1,1,0,2,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,32,8,128,0,0,0,0,0,0,0,0,0,0,0,0,32,0,8,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,0,0,4,0,0,0,0,0,0,
+	 0,0,0,0,16,0,0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,4,0,0,0,0,0,0,
+	 0,0,0,0,0,0,16,0,0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,4,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,16,4,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,32,8,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,8,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,0,0,0,64,0,0,0,0,0,0,0,
+	 0,4,0,0,0,0,0,64,0,0,0,0,0,0,0,0,0,4,0,0,0,0,64,0,0,0,0,0,0,0,0,0,
+	 0,4,0,0,0,64,0,0,0,0,0,0,0,0,0,0,0,4,0,0,64,0,0,0,0,0,0,0,0,0,0,0,
+	 0,4,0,64,0,0,0,0,0,0,0,0,0,0,0,0,0,4,64,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,2,2,2,2,2,2,2,2,0,0,0,0,0,0,0,8,128,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,0,0,0,64,0,0,0,0,0,0,
+	 0,0,4,0,0,0,0,0,64,0,0,0,0,0,0,0,0,0,4,0,0,0,0,64,0,0,0,0,0,0,0,0,
+	 0,0,4,0,0,0,64,0,0,0,0,0,0,0,0,0,0,0,4,0,0,64,0,0,0,0,0,0,0,0,0,0,
+	 0,0,4,0,64,0,0,0,0,0,0,0,0,0,0,0,0,16,4,64,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,1,0,2,2,2,2,2,2,2,0,0,0,0,0,0,0,32,8,128,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,4,0,0,0,0,0,64,0,0,0,0,0,0,0,0,0,4,0,0,0,0,64,0,0,0,0,0,0,0,
+	 0,0,0,4,0,0,0,64,0,0,0,0,0,0,0,0,0,0,0,4,0,0,64,0,0,0,0,0,0,0,0,0,
+	 0,16,0,4,0,64,0,0,0,0,0,0,0,0,0,0,0,0,16,4,64,0,0,0,0,0,0,0,0,0,0,0,
+	 0,1,1,0,2,2,2,2,2,2,0,0,0,0,0,0,0,0,32,8,128,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,0,64,0,0,0,0,0,0,
+	 0,0,0,0,4,0,0,0,64,0,0,0,0,0,0,0,0,16,0,0,4,0,0,64,0,0,0,0,0,0,0,0,
+	 0,0,16,0,4,0,64,0,0,0,0,0,0,0,0,0,0,0,0,16,4,64,0,0,0,0,0,0,0,0,0,0,
+	 0,1,1,1,0,2,2,2,2,2,0,0,0,0,0,0,0,0,0,32,8,128,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,0,0,0,
+	 0,16,0,0,0,4,0,0,0,64,0,0,0,0,0,0,0,0,16,0,0,4,0,0,64,0,0,0,0,0,0,0,
+	 0,0,0,16,0,4,0,64,0,0,0,0,0,0,0,0,0,0,0,0,16,4,64,0,0,0,0,0,0,0,0,0,
+	 0,1,1,1,1,0,2,2,2,2,0,0,0,0,0,0,0,0,0,0,32,8,128,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,4,0,0,0,0,0,0,0,0,0,0,16,0,0,0,0,4,0,0,0,0,0,0,0,0,0,
+	 0,0,16,0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,4,0,0,64,0,0,0,0,0,0,
+	 0,0,0,0,16,0,4,0,64,0,0,0,0,0,0,0,0,0,0,0,0,16,4,64,0,0,0,0,0,0,0,0,
+	 0,1,1,1,1,1,0,2,2,2,0,0,0,0,0,0,0,0,0,0,0,32,8,128,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,0,
+	 0,16,0,0,0,0,0,4,0,0,0,0,0,0,0,0,0,0,16,0,0,0,0,4,0,0,0,0,0,0,0,0,
+	 0,0,0,16,0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,4,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,16,0,4,0,64,0,0,0,0,0,0,0,0,0,0,0,0,16,4,64,0,0,0,0,0,0,0,
+	 0,1,1,1,1,1,1,0,2,2,0,0,0,0,0,0,0,0,0,0,0,0,32,8,128,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,0,0,0,4,0,0,0,0,0,0,0,
+	 0,0,16,0,0,0,0,0,4,0,0,0,0,0,0,0,0,0,0,16,0,0,0,0,4,0,0,0,0,0,0,0,
+	 0,0,0,0,16,0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,4,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,16,0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,4,64,0,0,0,0,0,0,
+	 0,1,1,1,1,1,1,1,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,32,8,128,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,0,0,0,4,0,0,0,0,0,0,
+	 0,0,0,16,0,0,0,0,0,4,0,0,0,0,0,0,0,0,0,0,16,0,0,0,0,4,0,0,0,0,0,0,
+	 0,0,0,0,0,16,0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,4,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,16,0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,4,0,0,0,0,0,0,
+	 0,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,8,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,64,0,0,0,0,0,0,
+	 0,4,0,0,0,0,0,0,64,0,0,0,0,0,0,0,0,4,0,0,0,0,0,64,0,0,0,0,0,0,0,0,
+	 0,4,0,0,0,0,64,0,0,0,0,0,0,0,0,0,0,4,0,0,0,64,0,0,0,0,0,0,0,0,0,0,
+	 0,4,0,0,64,0,0,0,0,0,0,0,0,0,0,0,0,4,0,64,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,4,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,2,2,2,2,2,2,2,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,4,0,0,0,0,0,0,64,0,0,0,0,0,0,0,0,4,0,0,0,0,0,64,0,0,0,0,0,0,0,
+	 0,0,4,0,0,0,0,64,0,0,0,0,0,0,0,0,0,0,4,0,0,0,64,0,0,0,0,0,0,0,0,0,
+	 0,0,4,0,0,64,0,0,0,0,0,0,0,0,0,0,0,0,4,0,64,0,0,0,0,0,0,0,0,0,0,0,
+	 0,16,4,64,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,2,2,2,2,2,2,2,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,0,0,64,0,0,0,0,0,0,
+	 0,0,0,4,0,0,0,0,64,0,0,0,0,0,0,0,0,0,0,4,0,0,0,64,0,0,0,0,0,0,0,0,
+	 0,0,0,4,0,0,64,0,0,0,0,0,0,0,0,0,0,16,0,4,0,64,0,0,0,0,0,0,0,0,0,0,
+	 0,0,16,4,64,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,2,2,2,2,2,2,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,4,0,0,0,0,64,0,0,0,0,0,0,0,0,0,0,4,0,0,0,64,0,0,0,0,0,0,0,
+	 0,16,0,0,4,0,0,64,0,0,0,0,0,0,0,0,0,0,16,0,4,0,64,0,0,0,0,0,0,0,0,0,
+	 0,0,0,16,4,64,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,2,2,2,2,2,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,4,0,0,0,64,0,0,0,0,0,0,
+	 0,0,16,0,0,4,0,0,64,0,0,0,0,0,0,0,0,0,0,16,0,4,0,64,0,0,0,0,0,0,0,0,
+	 0,0,0,0,16,4,64,0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,2,2,2,2,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,0,0,
+	 0,16,0,0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,4,0,0,0,0,0,0,0,0,0,
+	 0,0,0,16,0,0,4,0,0,64,0,0,0,0,0,0,0,0,0,0,16,0,4,0,64,0,0,0,0,0,0,0,
+	 0,0,0,0,0,16,4,64,0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,2,2,2,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,0,0,16,0,0,0,0,0,4,0,0,0,0,0,0,0,0,
+	 0,0,16,0,0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,4,0,0,0,0,0,0,0,0,
+	 0,0,0,0,16,0,0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,4,0,64,0,0,0,0,0,0,
+	 0,0,0,0,0,0,16,4,64,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,2,2,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,
+	 0,16,0,0,0,0,0,0,4,0,0,0,0,0,0,0,0,0,16,0,0,0,0,0,4,0,0,0,0,0,0,0,
+	 0,0,0,16,0,0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,4,0,0,0,0,0,0,0,
+	 0,0,0,0,0,16,0,0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,4,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,16,4,64,0,0,0,0,0,0,0,1,1,1,1,1,1,1,0,2,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,0,0,0,0,4,0,0,0,0,0,0,
+	 0,0,16,0,0,0,0,0,0,4,0,0,0,0,0,0,0,0,0,16,0,0,0,0,0,4,0,0,0,0,0,0,
+	 0,0,0,0,16,0,0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,4,0,0,0,0,0,0,
+	 0,0,0,0,0,0,16,0,0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,4,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,16,4,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,},
+};
+
+const uint32_t Position::TblMate1plydrop[0x10000] = {
+	0x00000000,0xDEB6DEA0,0xDEA0DEB6,0xDEB6DEB6,0xDEA0DEA0,0xDEB6DEA0,0xDEA0DEB6,0xDEB6DEB6,
+	0xDEA0DEA0,0xDEB6DEA0,0xDEA0DEB6,0xDEB6DEB6,0xDEA0DEA0,0xDEB6DEA0,0xDEA0DEB6,0xDEB6DEB6,
+	0xDE70C050,0xDEF6DEF0,0xDEF0DEF6,0xDEF6DEF6,0xDEF0DEF0,0xDEF6DEF0,0xDEF0DEF6,0xDEF6DEF6,
+	0xDEF0DEF0,0xDEF6DEF0,0xDEF0DEF6,0xDEF6DEF6,0xDEF0DEF0,0xDEF6DEF0,0xDEF0DEF6,0xDEF6DEF6,
+	0xDE70C050,0xDEF6DEF0,0xDEF0DEF6,0xDEF6DEF6,0xDEF0DEF0,0xDEF6DEF0,0xDEF0DEF6,0xDEF6DEF6,
+	0xDEF0DEF0,0xDEF6DEF0,0xDEF0DEF6,0xDEF6DEF6,0xDEF0DEF0,0xDEF6DEF0,0xDEF0DEF6,0xDEF6DEF6,
+	0xDE70C050,0xDEF6DEF0,0xDEF0DEF6,0xDEF6DEF6,0xDEF0DEF0,0xDEF6DEF0,0xDEF0DEF6,0xDEF6DEF6,
+	0xDEF0DEF0,0xDEF6DEF0,0xDEF0DEF6,0xDEF6DEF6,0xDEF0DEF0,0xDEF6DEF0,0xDEF0DEF6,0xDEF6DEF6,
+	0xC050DE70,0xDEF6DEF0,0xDEF0DEF6,0xDEF6DEF6,0xDEF0DEF0,0xDEF6DEF0,0xDEF0DEF6,0xDEF6DEF6,
+	0xDEF0DEF0,0xDEF6DEF0,0xDEF0DEF6,0xDEF6DEF6,0xDEF0DEF0,0xDEF6DEF0,0xDEF0DEF6,0xDEF6DEF6,
+	0xDE70DE70,0xDEF6DEF0,0xDEF0DEF6,0xDEF6DEF6,0xDEF0DEF0,0xDEF6DEF0,0xDEF0DEF6,0xDEF6DEF6,
+	0xDEF0DEF0,0xDEF6DEF0,0xDEF0DEF6,0xDEF6DEF6,0xDEF0DEF0,0xDEF6DEF0,0xDEF0DEF6,0xDEF6DEF6,
+	0xDE70DE70,0xDEF6DEF0,0xDEF0DEF6,0xDEF6DEF6,0xDEF0DEF0,0xDEF6DEF0,0xDEF0DEF6,0xDEF6DEF6,
+	0xDEF0DEF0,0xDEF6DEF0,0xDEF0DEF6,0xDEF6DEF6,0xDEF0DEF0,0xDEF6DEF0,0xDEF0DEF6,0xDEF6DEF6,
+	0xDE70DE70,0xDEF6DEF0,0xDEF0DEF6,0xDEF6DEF6,0xDEF0DEF0,0xDEF6DEF0,0xDEF0DEF6,0xDEF6DEF6,
+	0xDEF0DEF0,0xDEF6DEF0,0xDEF0DEF6,0xDEF6DEF6,0xDEF0DEF0,0xDEF6DEF0,0xDEF0DEF6,0xDEF6DEF6,
+	0xC050DE70,0xDEF6DEF0,0xDEF0DEF6,0xDEF6DEF6,0xDEF0DEF0,0xDEF6DEF0,0xDEF0DEF6,0xDEF6DEF6,
+	0xDEF0DEF0,0xDEF6DEF0,0xDEF0DEF6,0xDEF6DEF6,0xDEF0DEF0,0xDEF6DEF0,0xDEF0DEF6,0xDEF6DEF6,
+	0xDE70DE70,0xDEF6DEF0,0xDEF0DEF6,0xDEF6DEF6,0xDEF0DEF0,0xDEF6DEF0,0xDEF0DEF6,0xDEF6DEF6,
+	0xDEF0DEF0,0xDEF6DEF0,0xDEF0DEF6,0xDEF6DEF6,0xDEF0DEF0,0xDEF6DEF0,0xDEF0DEF6,0xDEF6DEF6,
+	0xDE70DE70,0xDEF6DEF0,0xDEF0DEF6,0xDEF6DEF6,0xDEF0DEF0,0xDEF6DEF0,0xDEF0DEF6,0xDEF6DEF6,
+	0xDEF0DEF0,0xDEF6DEF0,0xDEF0DEF6,0xDEF6DEF6,0xDEF0DEF0,0xDEF6DEF0,0xDEF0DEF6,0xDEF6DEF6,
+	0xDE70DE70,0xDEF6DEF0,0xDEF0DEF6,0xDEF6DEF6,0xDEF0DEF0,0xDEF6DEF0,0xDEF0DEF6,0xDEF6DEF6,
+	0xDEF0DEF0,0xDEF6DEF0,0xDEF0DEF6,0xDEF6DEF6,0xDEF0DEF0,0xDEF6DEF0,0xDEF0DEF6,0xDEF6DEF6,
+	0xC050DE70,0xDEF6DEF0,0xDEF0DEF6,0xDEF6DEF6,0xDEF0DEF0,0xDEF6DEF0,0xDEF0DEF6,0xDEF6DEF6,
+	0xDEF0DEF0,0xDEF6DEF0,0xDEF0DEF6,0xDEF6DEF6,0xDEF0DEF0,0xDEF6DEF0,0xDEF0DEF6,0xDEF6DEF6,
+	0xDE70DE70,0xDEF6DEF0,0xDEF0DEF6,0xDEF6DEF6,0xDEF0DEF0,0xDEF6DEF0,0xDEF0DEF6,0xDEF6DEF6,
+	0xDEF0DEF0,0xDEF6DEF0,0xDEF0DEF6,0xDEF6DEF6,0xDEF0DEF0,0xDEF6DEF0,0xDEF0DEF6,0xDEF6DEF6,
+	0xDE70DE70,0xDEF6DEF0,0xDEF0DEF6,0xDEF6DEF6,0xDEF0DEF0,0xDEF6DEF0,0xDEF0DEF6,0xDEF6DEF6,
+	0xDEF0DEF0,0xDEF6DEF0,0xDEF0DEF6,0xDEF6DEF6,0xDEF0DEF0,0xDEF6DEF0,0xDEF0DEF6,0xDEF6DEF6,
+	0xDE70DE70,0xDEF6DEF0,0xDEF0DEF6,0xDEF6DEF6,0xDEF0DEF0,0xDEF6DEF0,0xDEF0DEF6,0xDEF6DEF6,
+	0xDEF0DEF0,0xDEF6DEF0,0xDEF0DEF6,0xDEF6DEF6,0xDEF0DEF0,0xDEF6DEF0,0xDEF0DEF6,0xDEF6DEF6,
+	0x00000000,0xDEB6DEA0,0x80808084,0xDEB6DEA4,0xC000DE20,0xDEB6DEA0,0xC080DEA4,0xDEB6DEA4,
+	0xC000DE20,0xDEB6DEA0,0xC080DEA4,0xDEB6DEA4,0xC000DE20,0xDEB6DEA0,0xC080DEA4,0xDEB6DEA4,
+	0xDE20C000,0xDEB6DEA0,0xDEA0C084,0xDEB6DEA4,0xDE20DE20,0xDEB6DEA0,0xDEA0DEA4,0xDEB6DEA4,
+	0xDE20DE20,0xDEB6DEA0,0xDEA0DEA4,0xDEB6DEA4,0xDE20DE20,0xDEB6DEA0,0xDEA0DEA4,0xDEB6DEA4,
+	0xDE20C000,0xDEB6DEA0,0xDEA0C084,0xDEB6DEA4,0xDE20DE20,0xDEB6DEA0,0xDEA0DEA4,0xDEB6DEA4,
+	0xDE20DE20,0xDEB6DEA0,0xDEA0DEA4,0xDEB6DEA4,0xDE20DE20,0xDEB6DEA0,0xDEA0DEA4,0xDEB6DEA4,
+	0xDE20C000,0xDEB6DEA0,0xDEA0C084,0xDEB6DEA4,0xDE20DE20,0xDEB6DEA0,0xDEA0DEA4,0xDEB6DEA4,
+	0xDE20DE20,0xDEB6DEA0,0xDEA0DEA4,0xDEB6DEA4,0xDE20DE20,0xDEB6DEA0,0xDEA0DEA4,0xDEB6DEA4,
+	0x00000000,0xDEB6DEA0,0x80808084,0xDEB6DEA4,0xC000DE20,0xDEB6DEA0,0xC080DEA4,0xDEB6DEA4,
+	0xC000DE20,0xDEB6DEA0,0xC080DEA4,0xDEB6DEA4,0xC000DE20,0xDEB6DEA0,0xC080DEA4,0xDEB6DEA4,
+	0xDE20C000,0xDEB6DEA0,0xDEA0C084,0xDEB6DEA4,0xDE20DE20,0xDEB6DEA0,0xDEA0DEA4,0xDEB6DEA4,
+	0xDE20DE20,0xDEB6DEA0,0xDEA0DEA4,0xDEB6DEA4,0xDE20DE20,0xDEB6DEA0,0xDEA0DEA4,0xDEB6DEA4,
+	0xDE20C000,0xDEB6DEA0,0xDEA0C084,0xDEB6DEA4,0xDE20DE20,0xDEB6DEA0,0xDEA0DEA4,0xDEB6DEA4,
+	0xDE20DE20,0xDEB6DEA0,0xDEA0DEA4,0xDEB6DEA4,0xDE20DE20,0xDEB6DEA0,0xDEA0DEA4,0xDEB6DEA4,
+	0xDE20C000,0xDEB6DEA0,0xDEA0C084,0xDEB6DEA4,0xDE20DE20,0xDEB6DEA0,0xDEA0DEA4,0xDEB6DEA4,
+	0xDE20DE20,0xDEB6DEA0,0xDEA0DEA4,0xDEB6DEA4,0xDE20DE20,0xDEB6DEA0,0xDEA0DEA4,0xDEB6DEA4,
+	0x00000000,0xDEB6DEA0,0x80808084,0xDEB6DEA4,0xC000DE20,0xDEB6DEA0,0xC080DEA4,0xDEB6DEA4,
+	0xC000DE20,0xDEB6DEA0,0xC080DEA4,0xDEB6DEA4,0xC000DE20,0xDEB6DEA0,0xC080DEA4,0xDEB6DEA4,
+	0xDE20C000,0xDEB6DEA0,0xDEA0C084,0xDEB6DEA4,0xDE20DE20,0xDEB6DEA0,0xDEA0DEA4,0xDEB6DEA4,
+	0xDE20DE20,0xDEB6DEA0,0xDEA0DEA4,0xDEB6DEA4,0xDE20DE20,0xDEB6DEA0,0xDEA0DEA4,0xDEB6DEA4,
+	0xDE20C000,0xDEB6DEA0,0xDEA0C084,0xDEB6DEA4,0xDE20DE20,0xDEB6DEA0,0xDEA0DEA4,0xDEB6DEA4,
+	0xDE20DE20,0xDEB6DEA0,0xDEA0DEA4,0xDEB6DEA4,0xDE20DE20,0xDEB6DEA0,0xDEA0DEA4,0xDEB6DEA4,
+	0xDE20C000,0xDEB6DEA0,0xDEA0C084,0xDEB6DEA4,0xDE20DE20,0xDEB6DEA0,0xDEA0DEA4,0xDEB6DEA4,
+	0xDE20DE20,0xDEB6DEA0,0xDEA0DEA4,0xDEB6DEA4,0xDE20DE20,0xDEB6DEA0,0xDEA0DEA4,0xDEB6DEA4,
+	0x00000000,0xDEB6DEA0,0x80808084,0xDEB6DEA4,0xC000DE20,0xDEB6DEA0,0xC080DEA4,0xDEB6DEA4,
+	0xC000DE20,0xDEB6DEA0,0xC080DEA4,0xDEB6DEA4,0xC000DE20,0xDEB6DEA0,0xC080DEA4,0xDEB6DEA4,
+	0xDE20C000,0xDEB6DEA0,0xDEA0C084,0xDEB6DEA4,0xDE20DE20,0xDEB6DEA0,0xDEA0DEA4,0xDEB6DEA4,
+	0xDE20DE20,0xDEB6DEA0,0xDEA0DEA4,0xDEB6DEA4,0xDE20DE20,0xDEB6DEA0,0xDEA0DEA4,0xDEB6DEA4,
+	0xDE20C000,0xDEB6DEA0,0xDEA0C084,0xDEB6DEA4,0xDE20DE20,0xDEB6DEA0,0xDEA0DEA4,0xDEB6DEA4,
+	0xDE20DE20,0xDEB6DEA0,0xDEA0DEA4,0xDEB6DEA4,0xDE20DE20,0xDEB6DEA0,0xDEA0DEA4,0xDEB6DEA4,
+	0xDE20C000,0xDEB6DEA0,0xDEA0C084,0xDEB6DEA4,0xDE20DE20,0xDEB6DEA0,0xDEA0DEA4,0xDEB6DEA4,
+	0xDE20DE20,0xDEB6DEA0,0xDEA0DEA4,0xDEB6DEA4,0xDE20DE20,0xDEB6DEA0,0xDEA0DEA4,0xDEB6DEA4,
+	0x00000000,0x80848080,0xDEA0DEB6,0xDEA4DEB6,0xDE20C000,0xDEA4C080,0xDEA0DEB6,0xDEA4DEB6,
+	0xDE20C000,0xDEA4C080,0xDEA0DEB6,0xDEA4DEB6,0xDE20C000,0xDEA4C080,0xDEA0DEB6,0xDEA4DEB6,
+	0x00000000,0x80848080,0xDEA0DEB6,0xDEA4DEB6,0xDE20C000,0xDEA4C080,0xDEA0DEB6,0xDEA4DEB6,
+	0xDE20C000,0xDEA4C080,0xDEA0DEB6,0xDEA4DEB6,0xDE20C000,0xDEA4C080,0xDEA0DEB6,0xDEA4DEB6,
+	0x00000000,0x80848080,0xDEA0DEB6,0xDEA4DEB6,0xDE20C000,0xDEA4C080,0xDEA0DEB6,0xDEA4DEB6,
+	0xDE20C000,0xDEA4C080,0xDEA0DEB6,0xDEA4DEB6,0xDE20C000,0xDEA4C080,0xDEA0DEB6,0xDEA4DEB6,
+	0x00000000,0x80848080,0xDEA0DEB6,0xDEA4DEB6,0xDE20C000,0xDEA4C080,0xDEA0DEB6,0xDEA4DEB6,
+	0xDE20C000,0xDEA4C080,0xDEA0DEB6,0xDEA4DEB6,0xDE20C000,0xDEA4C080,0xDEA0DEB6,0xDEA4DEB6,
+	0xC000DE20,0xC084DEA0,0xDEA0DEB6,0xDEA4DEB6,0xDE20DE20,0xDEA4DEA0,0xDEA0DEB6,0xDEA4DEB6,
+	0xDE20DE20,0xDEA4DEA0,0xDEA0DEB6,0xDEA4DEB6,0xDE20DE20,0xDEA4DEA0,0xDEA0DEB6,0xDEA4DEB6,
+	0xC000DE20,0xC084DEA0,0xDEA0DEB6,0xDEA4DEB6,0xDE20DE20,0xDEA4DEA0,0xDEA0DEB6,0xDEA4DEB6,
+	0xDE20DE20,0xDEA4DEA0,0xDEA0DEB6,0xDEA4DEB6,0xDE20DE20,0xDEA4DEA0,0xDEA0DEB6,0xDEA4DEB6,
+	0xC000DE20,0xC084DEA0,0xDEA0DEB6,0xDEA4DEB6,0xDE20DE20,0xDEA4DEA0,0xDEA0DEB6,0xDEA4DEB6,
+	0xDE20DE20,0xDEA4DEA0,0xDEA0DEB6,0xDEA4DEB6,0xDE20DE20,0xDEA4DEA0,0xDEA0DEB6,0xDEA4DEB6,
+	0xC000DE20,0xC084DEA0,0xDEA0DEB6,0xDEA4DEB6,0xDE20DE20,0xDEA4DEA0,0xDEA0DEB6,0xDEA4DEB6,
+	0xDE20DE20,0xDEA4DEA0,0xDEA0DEB6,0xDEA4DEB6,0xDE20DE20,0xDEA4DEA0,0xDEA0DEB6,0xDEA4DEB6,
+	0xC000DE20,0xC084DEA0,0xDEA0DEB6,0xDEA4DEB6,0xDE20DE20,0xDEA4DEA0,0xDEA0DEB6,0xDEA4DEB6,
+	0xDE20DE20,0xDEA4DEA0,0xDEA0DEB6,0xDEA4DEB6,0xDE20DE20,0xDEA4DEA0,0xDEA0DEB6,0xDEA4DEB6,
+	0xC000DE20,0xC084DEA0,0xDEA0DEB6,0xDEA4DEB6,0xDE20DE20,0xDEA4DEA0,0xDEA0DEB6,0xDEA4DEB6,
+	0xDE20DE20,0xDEA4DEA0,0xDEA0DEB6,0xDEA4DEB6,0xDE20DE20,0xDEA4DEA0,0xDEA0DEB6,0xDEA4DEB6,
+	0xC000DE20,0xC084DEA0,0xDEA0DEB6,0xDEA4DEB6,0xDE20DE20,0xDEA4DEA0,0xDEA0DEB6,0xDEA4DEB6,
+	0xDE20DE20,0xDEA4DEA0,0xDEA0DEB6,0xDEA4DEB6,0xDE20DE20,0xDEA4DEA0,0xDEA0DEB6,0xDEA4DEB6,
+	0xC000DE20,0xC084DEA0,0xDEA0DEB6,0xDEA4DEB6,0xDE20DE20,0xDEA4DEA0,0xDEA0DEB6,0xDEA4DEB6,
+	0xDE20DE20,0xDEA4DEA0,0xDEA0DEB6,0xDEA4DEB6,0xDE20DE20,0xDEA4DEA0,0xDEA0DEB6,0xDEA4DEB6,
+	0xC000DE20,0xC084DEA0,0xDEA0DEB6,0xDEA4DEB6,0xDE20DE20,0xDEA4DEA0,0xDEA0DEB6,0xDEA4DEB6,
+	0xDE20DE20,0xDEA4DEA0,0xDEA0DEB6,0xDEA4DEB6,0xDE20DE20,0xDEA4DEA0,0xDEA0DEB6,0xDEA4DEB6,
+	0xC000DE20,0xC084DEA0,0xDEA0DEB6,0xDEA4DEB6,0xDE20DE20,0xDEA4DEA0,0xDEA0DEB6,0xDEA4DEB6,
+	0xDE20DE20,0xDEA4DEA0,0xDEA0DEB6,0xDEA4DEB6,0xDE20DE20,0xDEA4DEA0,0xDEA0DEB6,0xDEA4DEB6,
+	0xC000DE20,0xC084DEA0,0xDEA0DEB6,0xDEA4DEB6,0xDE20DE20,0xDEA4DEA0,0xDEA0DEB6,0xDEA4DEB6,
+	0xDE20DE20,0xDEA4DEA0,0xDEA0DEB6,0xDEA4DEB6,0xDE20DE20,0xDEA4DEA0,0xDEA0DEB6,0xDEA4DEB6,
+	0xC000DE20,0xC084DEA0,0xDEA0DEB6,0xDEA4DEB6,0xDE20DE20,0xDEA4DEA0,0xDEA0DEB6,0xDEA4DEB6,
+	0xDE20DE20,0xDEA4DEA0,0xDEA0DEB6,0xDEA4DEB6,0xDE20DE20,0xDEA4DEA0,0xDEA0DEB6,0xDEA4DEB6,
+	0x00000000,0x80848080,0x80808084,0x80848084,0xC000C000,0xC084C080,0xC080C084,0xC084C084,
+	0xC000C000,0xC084C080,0xC080C084,0xC084C084,0xC000C000,0xC084C080,0xC080C084,0xC084C084,
+	0x00000000,0x80848080,0x80808084,0x80848084,0xC000C000,0xC084C080,0xC080C084,0xC084C084,
+	0xC000C000,0xC084C080,0xC080C084,0xC084C084,0xC000C000,0xC084C080,0xC080C084,0xC084C084,
+	0x00000000,0x80848080,0x80808084,0x80848084,0xC000C000,0xC084C080,0xC080C084,0xC084C084,
+	0xC000C000,0xC084C080,0xC080C084,0xC084C084,0xC000C000,0xC084C080,0xC080C084,0xC084C084,
+	0x00000000,0x80848080,0x80808084,0x80848084,0xC000C000,0xC084C080,0xC080C084,0xC084C084,
+	0xC000C000,0xC084C080,0xC080C084,0xC084C084,0xC000C000,0xC084C080,0xC080C084,0xC084C084,
+	0x00000000,0x80848080,0x80808084,0x80848084,0xC000C000,0xC084C080,0xC080C084,0xC084C084,
+	0xC000C000,0xC084C080,0xC080C084,0xC084C084,0xC000C000,0xC084C080,0xC080C084,0xC084C084,
+	0x00000000,0x80848080,0x80808084,0x80848084,0xC000C000,0xC084C080,0xC080C084,0xC084C084,
+	0xC000C000,0xC084C080,0xC080C084,0xC084C084,0xC000C000,0xC084C080,0xC080C084,0xC084C084,
+	0x00000000,0x80848080,0x80808084,0x80848084,0xC000C000,0xC084C080,0xC080C084,0xC084C084,
+	0xC000C000,0xC084C080,0xC080C084,0xC084C084,0xC000C000,0xC084C080,0xC080C084,0xC084C084,
+	0x00000000,0x80848080,0x80808084,0x80848084,0xC000C000,0xC084C080,0xC080C084,0xC084C084,
+	0xC000C000,0xC084C080,0xC080C084,0xC084C084,0xC000C000,0xC084C080,0xC080C084,0xC084C084,
+	0x00000000,0x80848080,0x80808084,0x80848084,0xC000C000,0xC084C080,0xC080C084,0xC084C084,
+	0xC000C000,0xC084C080,0xC080C084,0xC084C084,0xC000C000,0xC084C080,0xC080C084,0xC084C084,
+	0x00000000,0x80848080,0x80808084,0x80848084,0xC000C000,0xC084C080,0xC080C084,0xC084C084,
+	0xC000C000,0xC084C080,0xC080C084,0xC084C084,0xC000C000,0xC084C080,0xC080C084,0xC084C084,
+	0x00000000,0x80848080,0x80808084,0x80848084,0xC000C000,0xC084C080,0xC080C084,0xC084C084,
+	0xC000C000,0xC084C080,0xC080C084,0xC084C084,0xC000C000,0xC084C080,0xC080C084,0xC084C084,
+	0x00000000,0x80848080,0x80808084,0x80848084,0xC000C000,0xC084C080,0xC080C084,0xC084C084,
+	0xC000C000,0xC084C080,0xC080C084,0xC084C084,0xC000C000,0xC084C080,0xC080C084,0xC084C084,
+	0x00000000,0x80848080,0x80808084,0x80848084,0xC000C000,0xC084C080,0xC080C084,0xC084C084,
+	0xC000C000,0xC084C080,0xC080C084,0xC084C084,0xC000C000,0xC084C080,0xC080C084,0xC084C084,
+	0x00000000,0x80848080,0x80808084,0x80848084,0xC000C000,0xC084C080,0xC080C084,0xC084C084,
+	0xC000C000,0xC084C080,0xC080C084,0xC084C084,0xC000C000,0xC084C080,0xC080C084,0xC084C084,
+	0x00000000,0x80848080,0x80808084,0x80848084,0xC000C000,0xC084C080,0xC080C084,0xC084C084,
+	0xC000C000,0xC084C080,0xC080C084,0xC084C084,0xC000C000,0xC084C080,0xC080C084,0xC084C084,
+	0x00000000,0x80848080,0x80808084,0x80848084,0xC000C000,0xC084C080,0xC080C084,0xC084C084,
+	0xC000C000,0xC084C080,0xC080C084,0xC084C084,0xC000C000,0xC084C080,0xC080C084,0xC084C084,
+	0x00000000,0xDE30C000,0xC000DE30,0xDE30DE30,0xDEA0DEA0,0xDEB0DEA0,0xDEA0DEB0,0xDEB0DEB0,
+	0x80808080,0xDEB0C080,0xC080DEB0,0xDEB0DEB0,0xDEA0DEA0,0xDEB0DEA0,0xDEA0DEB0,0xDEB0DEB0,
+	0xDE30C000,0xDE30C000,0xDE30DE30,0xDE30DE30,0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEB0,0xDEB0DEB0,
+	0xDEB0C080,0xDEB0C080,0xDEB0DEB0,0xDEB0DEB0,0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEB0,0xDEB0DEB0,
+	0x00000000,0xDE30C000,0xC000DE30,0xDE30DE30,0xDEA0DEA0,0xDEB0DEA0,0xDEA0DEB0,0xDEB0DEB0,
+	0x80808080,0xDEB0C080,0xC080DEB0,0xDEB0DEB0,0xDEA0DEA0,0xDEB0DEA0,0xDEA0DEB0,0xDEB0DEB0,
+	0xDE30C000,0xDE30C000,0xDE30DE30,0xDE30DE30,0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEB0,0xDEB0DEB0,
+	0xDEB0C080,0xDEB0C080,0xDEB0DEB0,0xDEB0DEB0,0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEB0,0xDEB0DEB0,
+	0xC000DE30,0xDE30DE30,0xC000DE30,0xDE30DE30,0xDEA0DEB0,0xDEB0DEB0,0xDEA0DEB0,0xDEB0DEB0,
+	0xC080DEB0,0xDEB0DEB0,0xC080DEB0,0xDEB0DEB0,0xDEA0DEB0,0xDEB0DEB0,0xDEA0DEB0,0xDEB0DEB0,
+	0xDE30DE30,0xDE30DE30,0xDE30DE30,0xDE30DE30,0xDEB0DEB0,0xDEB0DEB0,0xDEB0DEB0,0xDEB0DEB0,
+	0xDEB0DEB0,0xDEB0DEB0,0xDEB0DEB0,0xDEB0DEB0,0xDEB0DEB0,0xDEB0DEB0,0xDEB0DEB0,0xDEB0DEB0,
+	0xC000DE30,0xDE30DE30,0xC000DE30,0xDE30DE30,0xDEA0DEB0,0xDEB0DEB0,0xDEA0DEB0,0xDEB0DEB0,
+	0xC080DEB0,0xDEB0DEB0,0xC080DEB0,0xDEB0DEB0,0xDEA0DEB0,0xDEB0DEB0,0xDEA0DEB0,0xDEB0DEB0,
+	0xDE30DE30,0xDE30DE30,0xDE30DE30,0xDE30DE30,0xDEB0DEB0,0xDEB0DEB0,0xDEB0DEB0,0xDEB0DEB0,
+	0xDEB0DEB0,0xDEB0DEB0,0xDEB0DEB0,0xDEB0DEB0,0xDEB0DEB0,0xDEB0DEB0,0xDEB0DEB0,0xDEB0DEB0,
+	0x00000000,0xDE30C000,0xC000DE30,0xDE30DE30,0xDEA0DEA0,0xDEB0DEA0,0xDEA0DEB0,0xDEB0DEB0,
+	0x80808080,0xDEB0C080,0xC080DEB0,0xDEB0DEB0,0xDEA0DEA0,0xDEB0DEA0,0xDEA0DEB0,0xDEB0DEB0,
+	0xDE30C000,0xDE30C000,0xDE30DE30,0xDE30DE30,0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEB0,0xDEB0DEB0,
+	0xDEB0C080,0xDEB0C080,0xDEB0DEB0,0xDEB0DEB0,0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEB0,0xDEB0DEB0,
+	0x00000000,0xDE30C000,0xC000DE30,0xDE30DE30,0xDEA0DEA0,0xDEB0DEA0,0xDEA0DEB0,0xDEB0DEB0,
+	0x80808080,0xDEB0C080,0xC080DEB0,0xDEB0DEB0,0xDEA0DEA0,0xDEB0DEA0,0xDEA0DEB0,0xDEB0DEB0,
+	0xDE30C000,0xDE30C000,0xDE30DE30,0xDE30DE30,0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEB0,0xDEB0DEB0,
+	0xDEB0C080,0xDEB0C080,0xDEB0DEB0,0xDEB0DEB0,0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEB0,0xDEB0DEB0,
+	0xC000DE30,0xDE30DE30,0xC000DE30,0xDE30DE30,0xDEA0DEB0,0xDEB0DEB0,0xDEA0DEB0,0xDEB0DEB0,
+	0xC080DEB0,0xDEB0DEB0,0xC080DEB0,0xDEB0DEB0,0xDEA0DEB0,0xDEB0DEB0,0xDEA0DEB0,0xDEB0DEB0,
+	0xDE30DE30,0xDE30DE30,0xDE30DE30,0xDE30DE30,0xDEB0DEB0,0xDEB0DEB0,0xDEB0DEB0,0xDEB0DEB0,
+	0xDEB0DEB0,0xDEB0DEB0,0xDEB0DEB0,0xDEB0DEB0,0xDEB0DEB0,0xDEB0DEB0,0xDEB0DEB0,0xDEB0DEB0,
+	0xC000DE30,0xDE30DE30,0xC000DE30,0xDE30DE30,0xDEA0DEB0,0xDEB0DEB0,0xDEA0DEB0,0xDEB0DEB0,
+	0xC080DEB0,0xDEB0DEB0,0xC080DEB0,0xDEB0DEB0,0xDEA0DEB0,0xDEB0DEB0,0xDEA0DEB0,0xDEB0DEB0,
+	0xDE30DE30,0xDE30DE30,0xDE30DE30,0xDE30DE30,0xDEB0DEB0,0xDEB0DEB0,0xDEB0DEB0,0xDEB0DEB0,
+	0xDEB0DEB0,0xDEB0DEB0,0xDEB0DEB0,0xDEB0DEB0,0xDEB0DEB0,0xDEB0DEB0,0xDEB0DEB0,0xDEB0DEB0,
+	0x00000000,0xDE30C000,0x80008000,0xDE30C000,0xC000DE20,0xDE30DE20,0xC000DE20,0xDE30DE20,
+	0x80008000,0xDE30C000,0x80008000,0xDE30C000,0xC000DE20,0xDE30DE20,0xC000DE20,0xDE30DE20,
+	0xDE20C000,0xDE30C000,0xDE20C000,0xDE30C000,0xDE20DE20,0xDE30DE20,0xDE20DE20,0xDE30DE20,
+	0xDE20C000,0xDE30C000,0xDE20C000,0xDE30C000,0xDE20DE20,0xDE30DE20,0xDE20DE20,0xDE30DE20,
+	0x00000000,0xDE30C000,0x80008000,0xDE30C000,0xC000DE20,0xDE30DE20,0xC000DE20,0xDE30DE20,
+	0x80008000,0xDE30C000,0x80008000,0xDE30C000,0xC000DE20,0xDE30DE20,0xC000DE20,0xDE30DE20,
+	0xDE20C000,0xDE30C000,0xDE20C000,0xDE30C000,0xDE20DE20,0xDE30DE20,0xDE20DE20,0xDE30DE20,
+	0xDE20C000,0xDE30C000,0xDE20C000,0xDE30C000,0xDE20DE20,0xDE30DE20,0xDE20DE20,0xDE30DE20,
+	0x00000000,0xDE30C000,0x80008000,0xDE30C000,0xC000DE20,0xDE30DE20,0xC000DE20,0xDE30DE20,
+	0x80008000,0xDE30C000,0x80008000,0xDE30C000,0xC000DE20,0xDE30DE20,0xC000DE20,0xDE30DE20,
+	0xDE20C000,0xDE30C000,0xDE20C000,0xDE30C000,0xDE20DE20,0xDE30DE20,0xDE20DE20,0xDE30DE20,
+	0xDE20C000,0xDE30C000,0xDE20C000,0xDE30C000,0xDE20DE20,0xDE30DE20,0xDE20DE20,0xDE30DE20,
+	0x00000000,0xDE30C000,0x80008000,0xDE30C000,0xC000DE20,0xDE30DE20,0xC000DE20,0xDE30DE20,
+	0x80008000,0xDE30C000,0x80008000,0xDE30C000,0xC000DE20,0xDE30DE20,0xC000DE20,0xDE30DE20,
+	0xDE20C000,0xDE30C000,0xDE20C000,0xDE30C000,0xDE20DE20,0xDE30DE20,0xDE20DE20,0xDE30DE20,
+	0xDE20C000,0xDE30C000,0xDE20C000,0xDE30C000,0xDE20DE20,0xDE30DE20,0xDE20DE20,0xDE30DE20,
+	0x00000000,0xDE30C000,0x80008000,0xDE30C000,0xC000DE20,0xDE30DE20,0xC000DE20,0xDE30DE20,
+	0x80008000,0xDE30C000,0x80008000,0xDE30C000,0xC000DE20,0xDE30DE20,0xC000DE20,0xDE30DE20,
+	0xDE20C000,0xDE30C000,0xDE20C000,0xDE30C000,0xDE20DE20,0xDE30DE20,0xDE20DE20,0xDE30DE20,
+	0xDE20C000,0xDE30C000,0xDE20C000,0xDE30C000,0xDE20DE20,0xDE30DE20,0xDE20DE20,0xDE30DE20,
+	0x00000000,0xDE30C000,0x80008000,0xDE30C000,0xC000DE20,0xDE30DE20,0xC000DE20,0xDE30DE20,
+	0x80008000,0xDE30C000,0x80008000,0xDE30C000,0xC000DE20,0xDE30DE20,0xC000DE20,0xDE30DE20,
+	0xDE20C000,0xDE30C000,0xDE20C000,0xDE30C000,0xDE20DE20,0xDE30DE20,0xDE20DE20,0xDE30DE20,
+	0xDE20C000,0xDE30C000,0xDE20C000,0xDE30C000,0xDE20DE20,0xDE30DE20,0xDE20DE20,0xDE30DE20,
+	0x00000000,0xDE30C000,0x80008000,0xDE30C000,0xC000DE20,0xDE30DE20,0xC000DE20,0xDE30DE20,
+	0x80008000,0xDE30C000,0x80008000,0xDE30C000,0xC000DE20,0xDE30DE20,0xC000DE20,0xDE30DE20,
+	0xDE20C000,0xDE30C000,0xDE20C000,0xDE30C000,0xDE20DE20,0xDE30DE20,0xDE20DE20,0xDE30DE20,
+	0xDE20C000,0xDE30C000,0xDE20C000,0xDE30C000,0xDE20DE20,0xDE30DE20,0xDE20DE20,0xDE30DE20,
+	0x00000000,0xDE30C000,0x80008000,0xDE30C000,0xC000DE20,0xDE30DE20,0xC000DE20,0xDE30DE20,
+	0x80008000,0xDE30C000,0x80008000,0xDE30C000,0xC000DE20,0xDE30DE20,0xC000DE20,0xDE30DE20,
+	0xDE20C000,0xDE30C000,0xDE20C000,0xDE30C000,0xDE20DE20,0xDE30DE20,0xDE20DE20,0xDE30DE20,
+	0xDE20C000,0xDE30C000,0xDE20C000,0xDE30C000,0xDE20DE20,0xDE30DE20,0xDE20DE20,0xDE30DE20,
+	0x00000000,0x80008000,0xC000DE30,0xC000DE30,0xDE20C000,0xDE20C000,0xDE20DE30,0xDE20DE30,
+	0x80008000,0x80008000,0xC000DE30,0xC000DE30,0xDE20C000,0xDE20C000,0xDE20DE30,0xDE20DE30,
+	0x00000000,0x80008000,0xC000DE30,0xC000DE30,0xDE20C000,0xDE20C000,0xDE20DE30,0xDE20DE30,
+	0x80008000,0x80008000,0xC000DE30,0xC000DE30,0xDE20C000,0xDE20C000,0xDE20DE30,0xDE20DE30,
+	0x00000000,0x80008000,0xC000DE30,0xC000DE30,0xDE20C000,0xDE20C000,0xDE20DE30,0xDE20DE30,
+	0x80008000,0x80008000,0xC000DE30,0xC000DE30,0xDE20C000,0xDE20C000,0xDE20DE30,0xDE20DE30,
+	0x00000000,0x80008000,0xC000DE30,0xC000DE30,0xDE20C000,0xDE20C000,0xDE20DE30,0xDE20DE30,
+	0x80008000,0x80008000,0xC000DE30,0xC000DE30,0xDE20C000,0xDE20C000,0xDE20DE30,0xDE20DE30,
+	0xC000DE20,0xC000DE20,0xC000DE30,0xC000DE30,0xDE20DE20,0xDE20DE20,0xDE20DE30,0xDE20DE30,
+	0xC000DE20,0xC000DE20,0xC000DE30,0xC000DE30,0xDE20DE20,0xDE20DE20,0xDE20DE30,0xDE20DE30,
+	0xC000DE20,0xC000DE20,0xC000DE30,0xC000DE30,0xDE20DE20,0xDE20DE20,0xDE20DE30,0xDE20DE30,
+	0xC000DE20,0xC000DE20,0xC000DE30,0xC000DE30,0xDE20DE20,0xDE20DE20,0xDE20DE30,0xDE20DE30,
+	0xC000DE20,0xC000DE20,0xC000DE30,0xC000DE30,0xDE20DE20,0xDE20DE20,0xDE20DE30,0xDE20DE30,
+	0xC000DE20,0xC000DE20,0xC000DE30,0xC000DE30,0xDE20DE20,0xDE20DE20,0xDE20DE30,0xDE20DE30,
+	0xC000DE20,0xC000DE20,0xC000DE30,0xC000DE30,0xDE20DE20,0xDE20DE20,0xDE20DE30,0xDE20DE30,
+	0xC000DE20,0xC000DE20,0xC000DE30,0xC000DE30,0xDE20DE20,0xDE20DE20,0xDE20DE30,0xDE20DE30,
+	0x00000000,0x80008000,0xC000DE30,0xC000DE30,0xDE20C000,0xDE20C000,0xDE20DE30,0xDE20DE30,
+	0x80008000,0x80008000,0xC000DE30,0xC000DE30,0xDE20C000,0xDE20C000,0xDE20DE30,0xDE20DE30,
+	0x00000000,0x80008000,0xC000DE30,0xC000DE30,0xDE20C000,0xDE20C000,0xDE20DE30,0xDE20DE30,
+	0x80008000,0x80008000,0xC000DE30,0xC000DE30,0xDE20C000,0xDE20C000,0xDE20DE30,0xDE20DE30,
+	0x00000000,0x80008000,0xC000DE30,0xC000DE30,0xDE20C000,0xDE20C000,0xDE20DE30,0xDE20DE30,
+	0x80008000,0x80008000,0xC000DE30,0xC000DE30,0xDE20C000,0xDE20C000,0xDE20DE30,0xDE20DE30,
+	0x00000000,0x80008000,0xC000DE30,0xC000DE30,0xDE20C000,0xDE20C000,0xDE20DE30,0xDE20DE30,
+	0x80008000,0x80008000,0xC000DE30,0xC000DE30,0xDE20C000,0xDE20C000,0xDE20DE30,0xDE20DE30,
+	0xC000DE20,0xC000DE20,0xC000DE30,0xC000DE30,0xDE20DE20,0xDE20DE20,0xDE20DE30,0xDE20DE30,
+	0xC000DE20,0xC000DE20,0xC000DE30,0xC000DE30,0xDE20DE20,0xDE20DE20,0xDE20DE30,0xDE20DE30,
+	0xC000DE20,0xC000DE20,0xC000DE30,0xC000DE30,0xDE20DE20,0xDE20DE20,0xDE20DE30,0xDE20DE30,
+	0xC000DE20,0xC000DE20,0xC000DE30,0xC000DE30,0xDE20DE20,0xDE20DE20,0xDE20DE30,0xDE20DE30,
+	0xC000DE20,0xC000DE20,0xC000DE30,0xC000DE30,0xDE20DE20,0xDE20DE20,0xDE20DE30,0xDE20DE30,
+	0xC000DE20,0xC000DE20,0xC000DE30,0xC000DE30,0xDE20DE20,0xDE20DE20,0xDE20DE30,0xDE20DE30,
+	0xC000DE20,0xC000DE20,0xC000DE30,0xC000DE30,0xDE20DE20,0xDE20DE20,0xDE20DE30,0xDE20DE30,
+	0xC000DE20,0xC000DE20,0xC000DE30,0xC000DE30,0xDE20DE20,0xDE20DE20,0xDE20DE30,0xDE20DE30,
+	0x00000000,0x80008000,0x80008000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x80008000,0x80008000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x80008000,0x80008000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x80008000,0x80008000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x80008000,0x80008000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x80008000,0x80008000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x80008000,0x80008000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x80008000,0x80008000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x80008000,0x80008000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x80008000,0x80008000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x80008000,0x80008000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x80008000,0x80008000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x80008000,0x80008000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x80008000,0x80008000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x80008000,0x80008000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x80008000,0x80008000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0xDE30C000,0xC000DE30,0xDE30DE30,0x80808080,0xDEB0C080,0xC080DEB0,0xDEB0DEB0,
+	0xDEA0DEA0,0xDEB0DEA0,0xDEA0DEB0,0xDEB0DEB0,0xDEA0DEA0,0xDEB0DEA0,0xDEA0DEB0,0xDEB0DEB0,
+	0x00000000,0xDE30C000,0xC000DE30,0xDE30DE30,0x80808080,0xDEB0C080,0xC080DEB0,0xDEB0DEB0,
+	0xDEA0DEA0,0xDEB0DEA0,0xDEA0DEB0,0xDEB0DEB0,0xDEA0DEA0,0xDEB0DEA0,0xDEA0DEB0,0xDEB0DEB0,
+	0xDE30C000,0xDE30C000,0xDE30DE30,0xDE30DE30,0xDEB0C080,0xDEB0C080,0xDEB0DEB0,0xDEB0DEB0,
+	0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEB0,0xDEB0DEB0,0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEB0,0xDEB0DEB0,
+	0xDE30C000,0xDE30C000,0xDE30DE30,0xDE30DE30,0xDEB0C080,0xDEB0C080,0xDEB0DEB0,0xDEB0DEB0,
+	0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEB0,0xDEB0DEB0,0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEB0,0xDEB0DEB0,
+	0x00000000,0xDE30C000,0xC000DE30,0xDE30DE30,0x80808080,0xDEB0C080,0xC080DEB0,0xDEB0DEB0,
+	0xDEA0DEA0,0xDEB0DEA0,0xDEA0DEB0,0xDEB0DEB0,0xDEA0DEA0,0xDEB0DEA0,0xDEA0DEB0,0xDEB0DEB0,
+	0x00000000,0xDE30C000,0xC000DE30,0xDE30DE30,0x80808080,0xDEB0C080,0xC080DEB0,0xDEB0DEB0,
+	0xDEA0DEA0,0xDEB0DEA0,0xDEA0DEB0,0xDEB0DEB0,0xDEA0DEA0,0xDEB0DEA0,0xDEA0DEB0,0xDEB0DEB0,
+	0xDE30C000,0xDE30C000,0xDE30DE30,0xDE30DE30,0xDEB0C080,0xDEB0C080,0xDEB0DEB0,0xDEB0DEB0,
+	0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEB0,0xDEB0DEB0,0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEB0,0xDEB0DEB0,
+	0xDE30C000,0xDE30C000,0xDE30DE30,0xDE30DE30,0xDEB0C080,0xDEB0C080,0xDEB0DEB0,0xDEB0DEB0,
+	0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEB0,0xDEB0DEB0,0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEB0,0xDEB0DEB0,
+	0xC000DE30,0xDE30DE30,0xC000DE30,0xDE30DE30,0xC080DEB0,0xDEB0DEB0,0xC080DEB0,0xDEB0DEB0,
+	0xDEA0DEB0,0xDEB0DEB0,0xDEA0DEB0,0xDEB0DEB0,0xDEA0DEB0,0xDEB0DEB0,0xDEA0DEB0,0xDEB0DEB0,
+	0xC000DE30,0xDE30DE30,0xC000DE30,0xDE30DE30,0xC080DEB0,0xDEB0DEB0,0xC080DEB0,0xDEB0DEB0,
+	0xDEA0DEB0,0xDEB0DEB0,0xDEA0DEB0,0xDEB0DEB0,0xDEA0DEB0,0xDEB0DEB0,0xDEA0DEB0,0xDEB0DEB0,
+	0xDE30DE30,0xDE30DE30,0xDE30DE30,0xDE30DE30,0xDEB0DEB0,0xDEB0DEB0,0xDEB0DEB0,0xDEB0DEB0,
+	0xDEB0DEB0,0xDEB0DEB0,0xDEB0DEB0,0xDEB0DEB0,0xDEB0DEB0,0xDEB0DEB0,0xDEB0DEB0,0xDEB0DEB0,
+	0xDE30DE30,0xDE30DE30,0xDE30DE30,0xDE30DE30,0xDEB0DEB0,0xDEB0DEB0,0xDEB0DEB0,0xDEB0DEB0,
+	0xDEB0DEB0,0xDEB0DEB0,0xDEB0DEB0,0xDEB0DEB0,0xDEB0DEB0,0xDEB0DEB0,0xDEB0DEB0,0xDEB0DEB0,
+	0xC000DE30,0xDE30DE30,0xC000DE30,0xDE30DE30,0xC080DEB0,0xDEB0DEB0,0xC080DEB0,0xDEB0DEB0,
+	0xDEA0DEB0,0xDEB0DEB0,0xDEA0DEB0,0xDEB0DEB0,0xDEA0DEB0,0xDEB0DEB0,0xDEA0DEB0,0xDEB0DEB0,
+	0xC000DE30,0xDE30DE30,0xC000DE30,0xDE30DE30,0xC080DEB0,0xDEB0DEB0,0xC080DEB0,0xDEB0DEB0,
+	0xDEA0DEB0,0xDEB0DEB0,0xDEA0DEB0,0xDEB0DEB0,0xDEA0DEB0,0xDEB0DEB0,0xDEA0DEB0,0xDEB0DEB0,
+	0xDE30DE30,0xDE30DE30,0xDE30DE30,0xDE30DE30,0xDEB0DEB0,0xDEB0DEB0,0xDEB0DEB0,0xDEB0DEB0,
+	0xDEB0DEB0,0xDEB0DEB0,0xDEB0DEB0,0xDEB0DEB0,0xDEB0DEB0,0xDEB0DEB0,0xDEB0DEB0,0xDEB0DEB0,
+	0xDE30DE30,0xDE30DE30,0xDE30DE30,0xDE30DE30,0xDEB0DEB0,0xDEB0DEB0,0xDEB0DEB0,0xDEB0DEB0,
+	0xDEB0DEB0,0xDEB0DEB0,0xDEB0DEB0,0xDEB0DEB0,0xDEB0DEB0,0xDEB0DEB0,0xDEB0DEB0,0xDEB0DEB0,
+	0x00000000,0xDE30C000,0x80008000,0xDE30C000,0x80008000,0xDE30C000,0x80008000,0xDE30C000,
+	0xC000DE20,0xDE30DE20,0xC000DE20,0xDE30DE20,0xC000DE20,0xDE30DE20,0xC000DE20,0xDE30DE20,
+	0x00000000,0xDE30C000,0x80008000,0xDE30C000,0x80008000,0xDE30C000,0x80008000,0xDE30C000,
+	0xC000DE20,0xDE30DE20,0xC000DE20,0xDE30DE20,0xC000DE20,0xDE30DE20,0xC000DE20,0xDE30DE20,
+	0xDE20C000,0xDE30C000,0xDE20C000,0xDE30C000,0xDE20C000,0xDE30C000,0xDE20C000,0xDE30C000,
+	0xDE20DE20,0xDE30DE20,0xDE20DE20,0xDE30DE20,0xDE20DE20,0xDE30DE20,0xDE20DE20,0xDE30DE20,
+	0xDE20C000,0xDE30C000,0xDE20C000,0xDE30C000,0xDE20C000,0xDE30C000,0xDE20C000,0xDE30C000,
+	0xDE20DE20,0xDE30DE20,0xDE20DE20,0xDE30DE20,0xDE20DE20,0xDE30DE20,0xDE20DE20,0xDE30DE20,
+	0x00000000,0xDE30C000,0x80008000,0xDE30C000,0x80008000,0xDE30C000,0x80008000,0xDE30C000,
+	0xC000DE20,0xDE30DE20,0xC000DE20,0xDE30DE20,0xC000DE20,0xDE30DE20,0xC000DE20,0xDE30DE20,
+	0x00000000,0xDE30C000,0x80008000,0xDE30C000,0x80008000,0xDE30C000,0x80008000,0xDE30C000,
+	0xC000DE20,0xDE30DE20,0xC000DE20,0xDE30DE20,0xC000DE20,0xDE30DE20,0xC000DE20,0xDE30DE20,
+	0xDE20C000,0xDE30C000,0xDE20C000,0xDE30C000,0xDE20C000,0xDE30C000,0xDE20C000,0xDE30C000,
+	0xDE20DE20,0xDE30DE20,0xDE20DE20,0xDE30DE20,0xDE20DE20,0xDE30DE20,0xDE20DE20,0xDE30DE20,
+	0xDE20C000,0xDE30C000,0xDE20C000,0xDE30C000,0xDE20C000,0xDE30C000,0xDE20C000,0xDE30C000,
+	0xDE20DE20,0xDE30DE20,0xDE20DE20,0xDE30DE20,0xDE20DE20,0xDE30DE20,0xDE20DE20,0xDE30DE20,
+	0x00000000,0xDE30C000,0x80008000,0xDE30C000,0x80008000,0xDE30C000,0x80008000,0xDE30C000,
+	0xC000DE20,0xDE30DE20,0xC000DE20,0xDE30DE20,0xC000DE20,0xDE30DE20,0xC000DE20,0xDE30DE20,
+	0x00000000,0xDE30C000,0x80008000,0xDE30C000,0x80008000,0xDE30C000,0x80008000,0xDE30C000,
+	0xC000DE20,0xDE30DE20,0xC000DE20,0xDE30DE20,0xC000DE20,0xDE30DE20,0xC000DE20,0xDE30DE20,
+	0xDE20C000,0xDE30C000,0xDE20C000,0xDE30C000,0xDE20C000,0xDE30C000,0xDE20C000,0xDE30C000,
+	0xDE20DE20,0xDE30DE20,0xDE20DE20,0xDE30DE20,0xDE20DE20,0xDE30DE20,0xDE20DE20,0xDE30DE20,
+	0xDE20C000,0xDE30C000,0xDE20C000,0xDE30C000,0xDE20C000,0xDE30C000,0xDE20C000,0xDE30C000,
+	0xDE20DE20,0xDE30DE20,0xDE20DE20,0xDE30DE20,0xDE20DE20,0xDE30DE20,0xDE20DE20,0xDE30DE20,
+	0x00000000,0xDE30C000,0x80008000,0xDE30C000,0x80008000,0xDE30C000,0x80008000,0xDE30C000,
+	0xC000DE20,0xDE30DE20,0xC000DE20,0xDE30DE20,0xC000DE20,0xDE30DE20,0xC000DE20,0xDE30DE20,
+	0x00000000,0xDE30C000,0x80008000,0xDE30C000,0x80008000,0xDE30C000,0x80008000,0xDE30C000,
+	0xC000DE20,0xDE30DE20,0xC000DE20,0xDE30DE20,0xC000DE20,0xDE30DE20,0xC000DE20,0xDE30DE20,
+	0xDE20C000,0xDE30C000,0xDE20C000,0xDE30C000,0xDE20C000,0xDE30C000,0xDE20C000,0xDE30C000,
+	0xDE20DE20,0xDE30DE20,0xDE20DE20,0xDE30DE20,0xDE20DE20,0xDE30DE20,0xDE20DE20,0xDE30DE20,
+	0xDE20C000,0xDE30C000,0xDE20C000,0xDE30C000,0xDE20C000,0xDE30C000,0xDE20C000,0xDE30C000,
+	0xDE20DE20,0xDE30DE20,0xDE20DE20,0xDE30DE20,0xDE20DE20,0xDE30DE20,0xDE20DE20,0xDE30DE20,
+	0x00000000,0x80008000,0xC000DE30,0xC000DE30,0x80008000,0x80008000,0xC000DE30,0xC000DE30,
+	0xDE20C000,0xDE20C000,0xDE20DE30,0xDE20DE30,0xDE20C000,0xDE20C000,0xDE20DE30,0xDE20DE30,
+	0x00000000,0x80008000,0xC000DE30,0xC000DE30,0x80008000,0x80008000,0xC000DE30,0xC000DE30,
+	0xDE20C000,0xDE20C000,0xDE20DE30,0xDE20DE30,0xDE20C000,0xDE20C000,0xDE20DE30,0xDE20DE30,
+	0x00000000,0x80008000,0xC000DE30,0xC000DE30,0x80008000,0x80008000,0xC000DE30,0xC000DE30,
+	0xDE20C000,0xDE20C000,0xDE20DE30,0xDE20DE30,0xDE20C000,0xDE20C000,0xDE20DE30,0xDE20DE30,
+	0x00000000,0x80008000,0xC000DE30,0xC000DE30,0x80008000,0x80008000,0xC000DE30,0xC000DE30,
+	0xDE20C000,0xDE20C000,0xDE20DE30,0xDE20DE30,0xDE20C000,0xDE20C000,0xDE20DE30,0xDE20DE30,
+	0x00000000,0x80008000,0xC000DE30,0xC000DE30,0x80008000,0x80008000,0xC000DE30,0xC000DE30,
+	0xDE20C000,0xDE20C000,0xDE20DE30,0xDE20DE30,0xDE20C000,0xDE20C000,0xDE20DE30,0xDE20DE30,
+	0x00000000,0x80008000,0xC000DE30,0xC000DE30,0x80008000,0x80008000,0xC000DE30,0xC000DE30,
+	0xDE20C000,0xDE20C000,0xDE20DE30,0xDE20DE30,0xDE20C000,0xDE20C000,0xDE20DE30,0xDE20DE30,
+	0x00000000,0x80008000,0xC000DE30,0xC000DE30,0x80008000,0x80008000,0xC000DE30,0xC000DE30,
+	0xDE20C000,0xDE20C000,0xDE20DE30,0xDE20DE30,0xDE20C000,0xDE20C000,0xDE20DE30,0xDE20DE30,
+	0x00000000,0x80008000,0xC000DE30,0xC000DE30,0x80008000,0x80008000,0xC000DE30,0xC000DE30,
+	0xDE20C000,0xDE20C000,0xDE20DE30,0xDE20DE30,0xDE20C000,0xDE20C000,0xDE20DE30,0xDE20DE30,
+	0xC000DE20,0xC000DE20,0xC000DE30,0xC000DE30,0xC000DE20,0xC000DE20,0xC000DE30,0xC000DE30,
+	0xDE20DE20,0xDE20DE20,0xDE20DE30,0xDE20DE30,0xDE20DE20,0xDE20DE20,0xDE20DE30,0xDE20DE30,
+	0xC000DE20,0xC000DE20,0xC000DE30,0xC000DE30,0xC000DE20,0xC000DE20,0xC000DE30,0xC000DE30,
+	0xDE20DE20,0xDE20DE20,0xDE20DE30,0xDE20DE30,0xDE20DE20,0xDE20DE20,0xDE20DE30,0xDE20DE30,
+	0xC000DE20,0xC000DE20,0xC000DE30,0xC000DE30,0xC000DE20,0xC000DE20,0xC000DE30,0xC000DE30,
+	0xDE20DE20,0xDE20DE20,0xDE20DE30,0xDE20DE30,0xDE20DE20,0xDE20DE20,0xDE20DE30,0xDE20DE30,
+	0xC000DE20,0xC000DE20,0xC000DE30,0xC000DE30,0xC000DE20,0xC000DE20,0xC000DE30,0xC000DE30,
+	0xDE20DE20,0xDE20DE20,0xDE20DE30,0xDE20DE30,0xDE20DE20,0xDE20DE20,0xDE20DE30,0xDE20DE30,
+	0xC000DE20,0xC000DE20,0xC000DE30,0xC000DE30,0xC000DE20,0xC000DE20,0xC000DE30,0xC000DE30,
+	0xDE20DE20,0xDE20DE20,0xDE20DE30,0xDE20DE30,0xDE20DE20,0xDE20DE20,0xDE20DE30,0xDE20DE30,
+	0xC000DE20,0xC000DE20,0xC000DE30,0xC000DE30,0xC000DE20,0xC000DE20,0xC000DE30,0xC000DE30,
+	0xDE20DE20,0xDE20DE20,0xDE20DE30,0xDE20DE30,0xDE20DE20,0xDE20DE20,0xDE20DE30,0xDE20DE30,
+	0xC000DE20,0xC000DE20,0xC000DE30,0xC000DE30,0xC000DE20,0xC000DE20,0xC000DE30,0xC000DE30,
+	0xDE20DE20,0xDE20DE20,0xDE20DE30,0xDE20DE30,0xDE20DE20,0xDE20DE20,0xDE20DE30,0xDE20DE30,
+	0xC000DE20,0xC000DE20,0xC000DE30,0xC000DE30,0xC000DE20,0xC000DE20,0xC000DE30,0xC000DE30,
+	0xDE20DE20,0xDE20DE20,0xDE20DE30,0xDE20DE30,0xDE20DE20,0xDE20DE20,0xDE20DE30,0xDE20DE30,
+	0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0xDE30C000,0xC000DE30,0xDE30DE30,0x80808080,0xDEB0C080,0xC080DEB0,0xDEB0DEB0,
+	0x80808080,0xDEB0C080,0xC080DEB0,0xDEB0DEB0,0x80808080,0xDEB0C080,0xC080DEB0,0xDEB0DEB0,
+	0x00000000,0xDE30C000,0xC000DE30,0xDE30DE30,0x80808080,0xDEB0C080,0xC080DEB0,0xDEB0DEB0,
+	0x80808080,0xDEB0C080,0xC080DEB0,0xDEB0DEB0,0x80808080,0xDEB0C080,0xC080DEB0,0xDEB0DEB0,
+	0x00000000,0xDE30C000,0xC000DE30,0xDE30DE30,0x80808080,0xDEB0C080,0xC080DEB0,0xDEB0DEB0,
+	0x80808080,0xDEB0C080,0xC080DEB0,0xDEB0DEB0,0x80808080,0xDEB0C080,0xC080DEB0,0xDEB0DEB0,
+	0x00000000,0xDE30C000,0xC000DE30,0xDE30DE30,0x80808080,0xDEB0C080,0xC080DEB0,0xDEB0DEB0,
+	0x80808080,0xDEB0C080,0xC080DEB0,0xDEB0DEB0,0x80808080,0xDEB0C080,0xC080DEB0,0xDEB0DEB0,
+	0x00000000,0xDE30C000,0xC000DE30,0xDE30DE30,0x80808080,0xDEB0C080,0xC080DEB0,0xDEB0DEB0,
+	0x80808080,0xDEB0C080,0xC080DEB0,0xDEB0DEB0,0x80808080,0xDEB0C080,0xC080DEB0,0xDEB0DEB0,
+	0x00000000,0xDE30C000,0xC000DE30,0xDE30DE30,0x80808080,0xDEB0C080,0xC080DEB0,0xDEB0DEB0,
+	0x80808080,0xDEB0C080,0xC080DEB0,0xDEB0DEB0,0x80808080,0xDEB0C080,0xC080DEB0,0xDEB0DEB0,
+	0x00000000,0xDE30C000,0xC000DE30,0xDE30DE30,0x80808080,0xDEB0C080,0xC080DEB0,0xDEB0DEB0,
+	0x80808080,0xDEB0C080,0xC080DEB0,0xDEB0DEB0,0x80808080,0xDEB0C080,0xC080DEB0,0xDEB0DEB0,
+	0x00000000,0xDE30C000,0xC000DE30,0xDE30DE30,0x80808080,0xDEB0C080,0xC080DEB0,0xDEB0DEB0,
+	0x80808080,0xDEB0C080,0xC080DEB0,0xDEB0DEB0,0x80808080,0xDEB0C080,0xC080DEB0,0xDEB0DEB0,
+	0x00000000,0xDE30C000,0xC000DE30,0xDE30DE30,0x80808080,0xDEB0C080,0xC080DEB0,0xDEB0DEB0,
+	0x80808080,0xDEB0C080,0xC080DEB0,0xDEB0DEB0,0x80808080,0xDEB0C080,0xC080DEB0,0xDEB0DEB0,
+	0x00000000,0xDE30C000,0xC000DE30,0xDE30DE30,0x80808080,0xDEB0C080,0xC080DEB0,0xDEB0DEB0,
+	0x80808080,0xDEB0C080,0xC080DEB0,0xDEB0DEB0,0x80808080,0xDEB0C080,0xC080DEB0,0xDEB0DEB0,
+	0x00000000,0xDE30C000,0xC000DE30,0xDE30DE30,0x80808080,0xDEB0C080,0xC080DEB0,0xDEB0DEB0,
+	0x80808080,0xDEB0C080,0xC080DEB0,0xDEB0DEB0,0x80808080,0xDEB0C080,0xC080DEB0,0xDEB0DEB0,
+	0x00000000,0xDE30C000,0xC000DE30,0xDE30DE30,0x80808080,0xDEB0C080,0xC080DEB0,0xDEB0DEB0,
+	0x80808080,0xDEB0C080,0xC080DEB0,0xDEB0DEB0,0x80808080,0xDEB0C080,0xC080DEB0,0xDEB0DEB0,
+	0x00000000,0xDE30C000,0xC000DE30,0xDE30DE30,0x80808080,0xDEB0C080,0xC080DEB0,0xDEB0DEB0,
+	0x80808080,0xDEB0C080,0xC080DEB0,0xDEB0DEB0,0x80808080,0xDEB0C080,0xC080DEB0,0xDEB0DEB0,
+	0x00000000,0xDE30C000,0xC000DE30,0xDE30DE30,0x80808080,0xDEB0C080,0xC080DEB0,0xDEB0DEB0,
+	0x80808080,0xDEB0C080,0xC080DEB0,0xDEB0DEB0,0x80808080,0xDEB0C080,0xC080DEB0,0xDEB0DEB0,
+	0x00000000,0xDE30C000,0xC000DE30,0xDE30DE30,0x80808080,0xDEB0C080,0xC080DEB0,0xDEB0DEB0,
+	0x80808080,0xDEB0C080,0xC080DEB0,0xDEB0DEB0,0x80808080,0xDEB0C080,0xC080DEB0,0xDEB0DEB0,
+	0x00000000,0xDE30C000,0xC000DE30,0xDE30DE30,0x80808080,0xDEB0C080,0xC080DEB0,0xDEB0DEB0,
+	0x80808080,0xDEB0C080,0xC080DEB0,0xDEB0DEB0,0x80808080,0xDEB0C080,0xC080DEB0,0xDEB0DEB0,
+	0x00000000,0xDE30C000,0x80008000,0xDE30C000,0x80008000,0xDE30C000,0x80008000,0xDE30C000,
+	0x80008000,0xDE30C000,0x80008000,0xDE30C000,0x80008000,0xDE30C000,0x80008000,0xDE30C000,
+	0x00000000,0xDE30C000,0x80008000,0xDE30C000,0x80008000,0xDE30C000,0x80008000,0xDE30C000,
+	0x80008000,0xDE30C000,0x80008000,0xDE30C000,0x80008000,0xDE30C000,0x80008000,0xDE30C000,
+	0x00000000,0xDE30C000,0x80008000,0xDE30C000,0x80008000,0xDE30C000,0x80008000,0xDE30C000,
+	0x80008000,0xDE30C000,0x80008000,0xDE30C000,0x80008000,0xDE30C000,0x80008000,0xDE30C000,
+	0x00000000,0xDE30C000,0x80008000,0xDE30C000,0x80008000,0xDE30C000,0x80008000,0xDE30C000,
+	0x80008000,0xDE30C000,0x80008000,0xDE30C000,0x80008000,0xDE30C000,0x80008000,0xDE30C000,
+	0x00000000,0xDE30C000,0x80008000,0xDE30C000,0x80008000,0xDE30C000,0x80008000,0xDE30C000,
+	0x80008000,0xDE30C000,0x80008000,0xDE30C000,0x80008000,0xDE30C000,0x80008000,0xDE30C000,
+	0x00000000,0xDE30C000,0x80008000,0xDE30C000,0x80008000,0xDE30C000,0x80008000,0xDE30C000,
+	0x80008000,0xDE30C000,0x80008000,0xDE30C000,0x80008000,0xDE30C000,0x80008000,0xDE30C000,
+	0x00000000,0xDE30C000,0x80008000,0xDE30C000,0x80008000,0xDE30C000,0x80008000,0xDE30C000,
+	0x80008000,0xDE30C000,0x80008000,0xDE30C000,0x80008000,0xDE30C000,0x80008000,0xDE30C000,
+	0x00000000,0xDE30C000,0x80008000,0xDE30C000,0x80008000,0xDE30C000,0x80008000,0xDE30C000,
+	0x80008000,0xDE30C000,0x80008000,0xDE30C000,0x80008000,0xDE30C000,0x80008000,0xDE30C000,
+	0x00000000,0xDE30C000,0x80008000,0xDE30C000,0x80008000,0xDE30C000,0x80008000,0xDE30C000,
+	0x80008000,0xDE30C000,0x80008000,0xDE30C000,0x80008000,0xDE30C000,0x80008000,0xDE30C000,
+	0x00000000,0xDE30C000,0x80008000,0xDE30C000,0x80008000,0xDE30C000,0x80008000,0xDE30C000,
+	0x80008000,0xDE30C000,0x80008000,0xDE30C000,0x80008000,0xDE30C000,0x80008000,0xDE30C000,
+	0x00000000,0xDE30C000,0x80008000,0xDE30C000,0x80008000,0xDE30C000,0x80008000,0xDE30C000,
+	0x80008000,0xDE30C000,0x80008000,0xDE30C000,0x80008000,0xDE30C000,0x80008000,0xDE30C000,
+	0x00000000,0xDE30C000,0x80008000,0xDE30C000,0x80008000,0xDE30C000,0x80008000,0xDE30C000,
+	0x80008000,0xDE30C000,0x80008000,0xDE30C000,0x80008000,0xDE30C000,0x80008000,0xDE30C000,
+	0x00000000,0xDE30C000,0x80008000,0xDE30C000,0x80008000,0xDE30C000,0x80008000,0xDE30C000,
+	0x80008000,0xDE30C000,0x80008000,0xDE30C000,0x80008000,0xDE30C000,0x80008000,0xDE30C000,
+	0x00000000,0xDE30C000,0x80008000,0xDE30C000,0x80008000,0xDE30C000,0x80008000,0xDE30C000,
+	0x80008000,0xDE30C000,0x80008000,0xDE30C000,0x80008000,0xDE30C000,0x80008000,0xDE30C000,
+	0x00000000,0xDE30C000,0x80008000,0xDE30C000,0x80008000,0xDE30C000,0x80008000,0xDE30C000,
+	0x80008000,0xDE30C000,0x80008000,0xDE30C000,0x80008000,0xDE30C000,0x80008000,0xDE30C000,
+	0x00000000,0xDE30C000,0x80008000,0xDE30C000,0x80008000,0xDE30C000,0x80008000,0xDE30C000,
+	0x80008000,0xDE30C000,0x80008000,0xDE30C000,0x80008000,0xDE30C000,0x80008000,0xDE30C000,
+	0x00000000,0x80008000,0xC000DE30,0xC000DE30,0x80008000,0x80008000,0xC000DE30,0xC000DE30,
+	0x80008000,0x80008000,0xC000DE30,0xC000DE30,0x80008000,0x80008000,0xC000DE30,0xC000DE30,
+	0x00000000,0x80008000,0xC000DE30,0xC000DE30,0x80008000,0x80008000,0xC000DE30,0xC000DE30,
+	0x80008000,0x80008000,0xC000DE30,0xC000DE30,0x80008000,0x80008000,0xC000DE30,0xC000DE30,
+	0x00000000,0x80008000,0xC000DE30,0xC000DE30,0x80008000,0x80008000,0xC000DE30,0xC000DE30,
+	0x80008000,0x80008000,0xC000DE30,0xC000DE30,0x80008000,0x80008000,0xC000DE30,0xC000DE30,
+	0x00000000,0x80008000,0xC000DE30,0xC000DE30,0x80008000,0x80008000,0xC000DE30,0xC000DE30,
+	0x80008000,0x80008000,0xC000DE30,0xC000DE30,0x80008000,0x80008000,0xC000DE30,0xC000DE30,
+	0x00000000,0x80008000,0xC000DE30,0xC000DE30,0x80008000,0x80008000,0xC000DE30,0xC000DE30,
+	0x80008000,0x80008000,0xC000DE30,0xC000DE30,0x80008000,0x80008000,0xC000DE30,0xC000DE30,
+	0x00000000,0x80008000,0xC000DE30,0xC000DE30,0x80008000,0x80008000,0xC000DE30,0xC000DE30,
+	0x80008000,0x80008000,0xC000DE30,0xC000DE30,0x80008000,0x80008000,0xC000DE30,0xC000DE30,
+	0x00000000,0x80008000,0xC000DE30,0xC000DE30,0x80008000,0x80008000,0xC000DE30,0xC000DE30,
+	0x80008000,0x80008000,0xC000DE30,0xC000DE30,0x80008000,0x80008000,0xC000DE30,0xC000DE30,
+	0x00000000,0x80008000,0xC000DE30,0xC000DE30,0x80008000,0x80008000,0xC000DE30,0xC000DE30,
+	0x80008000,0x80008000,0xC000DE30,0xC000DE30,0x80008000,0x80008000,0xC000DE30,0xC000DE30,
+	0x00000000,0x80008000,0xC000DE30,0xC000DE30,0x80008000,0x80008000,0xC000DE30,0xC000DE30,
+	0x80008000,0x80008000,0xC000DE30,0xC000DE30,0x80008000,0x80008000,0xC000DE30,0xC000DE30,
+	0x00000000,0x80008000,0xC000DE30,0xC000DE30,0x80008000,0x80008000,0xC000DE30,0xC000DE30,
+	0x80008000,0x80008000,0xC000DE30,0xC000DE30,0x80008000,0x80008000,0xC000DE30,0xC000DE30,
+	0x00000000,0x80008000,0xC000DE30,0xC000DE30,0x80008000,0x80008000,0xC000DE30,0xC000DE30,
+	0x80008000,0x80008000,0xC000DE30,0xC000DE30,0x80008000,0x80008000,0xC000DE30,0xC000DE30,
+	0x00000000,0x80008000,0xC000DE30,0xC000DE30,0x80008000,0x80008000,0xC000DE30,0xC000DE30,
+	0x80008000,0x80008000,0xC000DE30,0xC000DE30,0x80008000,0x80008000,0xC000DE30,0xC000DE30,
+	0x00000000,0x80008000,0xC000DE30,0xC000DE30,0x80008000,0x80008000,0xC000DE30,0xC000DE30,
+	0x80008000,0x80008000,0xC000DE30,0xC000DE30,0x80008000,0x80008000,0xC000DE30,0xC000DE30,
+	0x00000000,0x80008000,0xC000DE30,0xC000DE30,0x80008000,0x80008000,0xC000DE30,0xC000DE30,
+	0x80008000,0x80008000,0xC000DE30,0xC000DE30,0x80008000,0x80008000,0xC000DE30,0xC000DE30,
+	0x00000000,0x80008000,0xC000DE30,0xC000DE30,0x80008000,0x80008000,0xC000DE30,0xC000DE30,
+	0x80008000,0x80008000,0xC000DE30,0xC000DE30,0x80008000,0x80008000,0xC000DE30,0xC000DE30,
+	0x00000000,0x80008000,0xC000DE30,0xC000DE30,0x80008000,0x80008000,0xC000DE30,0xC000DE30,
+	0x80008000,0x80008000,0xC000DE30,0xC000DE30,0x80008000,0x80008000,0xC000DE30,0xC000DE30,
+	0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0xDEA0DEA0,0x00000000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x00000000,0xDEA0DEA0,0x00000000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0xDE70C050,0xDEF0DEF0,0xDE70C050,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,
+	0xDE70C050,0xDEF0DEF0,0xDE70C050,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,
+	0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0xDE70C050,0xDEF0DEF0,0xDE70C050,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,
+	0xDE70C050,0xDEF0DEF0,0xDE70C050,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,
+	0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0xDE70C050,0xDEF0DEF0,0xDE70C050,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,
+	0xDE70C050,0xDEF0DEF0,0xDE70C050,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,
+	0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0xDE70C050,0xDEF0DEF0,0xDE70C050,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,
+	0xDE70C050,0xDEF0DEF0,0xDE70C050,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,
+	0x40404040,0xDEE0DEE0,0x40404040,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,
+	0x40404040,0xDEE0DEE0,0x40404040,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,
+	0xDE70C050,0xDEF0DEF0,0xDE70C050,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,
+	0xDE70C050,0xDEF0DEF0,0xDE70C050,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,
+	0xC040C040,0xDEE0DEE0,0xC040C040,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,
+	0xC040C040,0xDEE0DEE0,0xC040C040,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,
+	0xDE70C050,0xDEF0DEF0,0xDE70C050,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,
+	0xDE70C050,0xDEF0DEF0,0xDE70C050,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,
+	0xC040C040,0xDEE0DEE0,0xC040C040,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,
+	0xC040C040,0xDEE0DEE0,0xC040C040,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,
+	0xDE70C050,0xDEF0DEF0,0xDE70C050,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,
+	0xDE70C050,0xDEF0DEF0,0xDE70C050,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,
+	0xC040C040,0xDEE0DEE0,0xC040C040,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,
+	0xC040C040,0xDEE0DEE0,0xC040C040,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,
+	0xDE70C050,0xDEF0DEF0,0xDE70C050,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,
+	0xDE70C050,0xDEF0DEF0,0xDE70C050,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,
+	0x00000000,0xDEA0DEA0,0x00000000,0xDEA0DEA0,0xC000DE20,0xDEA0DEA0,0xC000DE20,0xDEA0DEA0,
+	0x00000000,0xDEA0DEA0,0x00000000,0xDEA0DEA0,0xC000DE20,0xDEA0DEA0,0xC000DE20,0xDEA0DEA0,
+	0xDE20C000,0xDEA0DEA0,0xDE20C000,0xDEA0DEA0,0xDE20DE20,0xDEA0DEA0,0xDE20DE20,0xDEA0DEA0,
+	0xDE20C000,0xDEA0DEA0,0xDE20C000,0xDEA0DEA0,0xDE20DE20,0xDEA0DEA0,0xDE20DE20,0xDEA0DEA0,
+	0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0xC000DE20,0xDEA0DEA0,0xC000DE20,0xDEA0DEA0,
+	0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0xC000DE20,0xDEA0DEA0,0xC000DE20,0xDEA0DEA0,
+	0xDE20C000,0xDEA0DEA0,0xDE20C000,0xDEA0DEA0,0xDE20DE20,0xDEA0DEA0,0xDE20DE20,0xDEA0DEA0,
+	0xDE20C000,0xDEA0DEA0,0xDE20C000,0xDEA0DEA0,0xDE20DE20,0xDEA0DEA0,0xDE20DE20,0xDEA0DEA0,
+	0x00000000,0xDEA0DEA0,0x00000000,0xDEA0DEA0,0xC000DE20,0xDEA0DEA0,0xC000DE20,0xDEA0DEA0,
+	0x00000000,0xDEA0DEA0,0x00000000,0xDEA0DEA0,0xC000DE20,0xDEA0DEA0,0xC000DE20,0xDEA0DEA0,
+	0xDE20C000,0xDEA0DEA0,0xDE20C000,0xDEA0DEA0,0xDE20DE20,0xDEA0DEA0,0xDE20DE20,0xDEA0DEA0,
+	0xDE20C000,0xDEA0DEA0,0xDE20C000,0xDEA0DEA0,0xDE20DE20,0xDEA0DEA0,0xDE20DE20,0xDEA0DEA0,
+	0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0xC000DE20,0xDEA0DEA0,0xC000DE20,0xDEA0DEA0,
+	0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0xC000DE20,0xDEA0DEA0,0xC000DE20,0xDEA0DEA0,
+	0xDE20C000,0xDEA0DEA0,0xDE20C000,0xDEA0DEA0,0xDE20DE20,0xDEA0DEA0,0xDE20DE20,0xDEA0DEA0,
+	0xDE20C000,0xDEA0DEA0,0xDE20C000,0xDEA0DEA0,0xDE20DE20,0xDEA0DEA0,0xDE20DE20,0xDEA0DEA0,
+	0x00000000,0xDEA0DEA0,0x00000000,0xDEA0DEA0,0xC000DE20,0xDEA0DEA0,0xC000DE20,0xDEA0DEA0,
+	0x00000000,0xDEA0DEA0,0x00000000,0xDEA0DEA0,0xC000DE20,0xDEA0DEA0,0xC000DE20,0xDEA0DEA0,
+	0xDE20C000,0xDEA0DEA0,0xDE20C000,0xDEA0DEA0,0xDE20DE20,0xDEA0DEA0,0xDE20DE20,0xDEA0DEA0,
+	0xDE20C000,0xDEA0DEA0,0xDE20C000,0xDEA0DEA0,0xDE20DE20,0xDEA0DEA0,0xDE20DE20,0xDEA0DEA0,
+	0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0xC000DE20,0xDEA0DEA0,0xC000DE20,0xDEA0DEA0,
+	0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0xC000DE20,0xDEA0DEA0,0xC000DE20,0xDEA0DEA0,
+	0xDE20C000,0xDEA0DEA0,0xDE20C000,0xDEA0DEA0,0xDE20DE20,0xDEA0DEA0,0xDE20DE20,0xDEA0DEA0,
+	0xDE20C000,0xDEA0DEA0,0xDE20C000,0xDEA0DEA0,0xDE20DE20,0xDEA0DEA0,0xDE20DE20,0xDEA0DEA0,
+	0x00000000,0xDEA0DEA0,0x00000000,0xDEA0DEA0,0xC000DE20,0xDEA0DEA0,0xC000DE20,0xDEA0DEA0,
+	0x00000000,0xDEA0DEA0,0x00000000,0xDEA0DEA0,0xC000DE20,0xDEA0DEA0,0xC000DE20,0xDEA0DEA0,
+	0xDE20C000,0xDEA0DEA0,0xDE20C000,0xDEA0DEA0,0xDE20DE20,0xDEA0DEA0,0xDE20DE20,0xDEA0DEA0,
+	0xDE20C000,0xDEA0DEA0,0xDE20C000,0xDEA0DEA0,0xDE20DE20,0xDEA0DEA0,0xDE20DE20,0xDEA0DEA0,
+	0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0xC000DE20,0xDEA0DEA0,0xC000DE20,0xDEA0DEA0,
+	0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0xC000DE20,0xDEA0DEA0,0xC000DE20,0xDEA0DEA0,
+	0xDE20C000,0xDEA0DEA0,0xDE20C000,0xDEA0DEA0,0xDE20DE20,0xDEA0DEA0,0xDE20DE20,0xDEA0DEA0,
+	0xDE20C000,0xDEA0DEA0,0xDE20C000,0xDEA0DEA0,0xDE20DE20,0xDEA0DEA0,0xDE20DE20,0xDEA0DEA0,
+	0x00000000,0x80808080,0x00000000,0x80808080,0xDE20C000,0xDEA0C080,0xDE20C000,0xDEA0C080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0xDE20C000,0xDEA0C080,0xDE20C000,0xDEA0C080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0xDE20C000,0xDEA0C080,0xDE20C000,0xDEA0C080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0xDE20C000,0xDEA0C080,0xDE20C000,0xDEA0C080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0xDE20C000,0xDEA0C080,0xDE20C000,0xDEA0C080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0xDE20C000,0xDEA0C080,0xDE20C000,0xDEA0C080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0xDE20C000,0xDEA0C080,0xDE20C000,0xDEA0C080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0xDE20C000,0xDEA0C080,0xDE20C000,0xDEA0C080,
+	0x80008000,0x80808080,0x80008000,0x80808080,0xDE20C000,0xDEA0C080,0xDE20C000,0xDEA0C080,
+	0x80008000,0x80808080,0x80008000,0x80808080,0xDE20C000,0xDEA0C080,0xDE20C000,0xDEA0C080,
+	0x80008000,0x80808080,0x80008000,0x80808080,0xDE20C000,0xDEA0C080,0xDE20C000,0xDEA0C080,
+	0x80008000,0x80808080,0x80008000,0x80808080,0xDE20C000,0xDEA0C080,0xDE20C000,0xDEA0C080,
+	0x80008000,0x80808080,0x80008000,0x80808080,0xDE20C000,0xDEA0C080,0xDE20C000,0xDEA0C080,
+	0x80008000,0x80808080,0x80008000,0x80808080,0xDE20C000,0xDEA0C080,0xDE20C000,0xDEA0C080,
+	0x80008000,0x80808080,0x80008000,0x80808080,0xDE20C000,0xDEA0C080,0xDE20C000,0xDEA0C080,
+	0x80008000,0x80808080,0x80008000,0x80808080,0xDE20C000,0xDEA0C080,0xDE20C000,0xDEA0C080,
+	0x40004000,0xC080C080,0x40004000,0xC080C080,0xDE20C000,0xDEA0C080,0xDE20C000,0xDEA0C080,
+	0x40004000,0xC080C080,0x40004000,0xC080C080,0xDE20C000,0xDEA0C080,0xDE20C000,0xDEA0C080,
+	0x40004000,0xC080C080,0x40004000,0xC080C080,0xDE20C000,0xDEA0C080,0xDE20C000,0xDEA0C080,
+	0x40004000,0xC080C080,0x40004000,0xC080C080,0xDE20C000,0xDEA0C080,0xDE20C000,0xDEA0C080,
+	0x40004000,0xC080C080,0x40004000,0xC080C080,0xDE20C000,0xDEA0C080,0xDE20C000,0xDEA0C080,
+	0x40004000,0xC080C080,0x40004000,0xC080C080,0xDE20C000,0xDEA0C080,0xDE20C000,0xDEA0C080,
+	0x40004000,0xC080C080,0x40004000,0xC080C080,0xDE20C000,0xDEA0C080,0xDE20C000,0xDEA0C080,
+	0x40004000,0xC080C080,0x40004000,0xC080C080,0xDE20C000,0xDEA0C080,0xDE20C000,0xDEA0C080,
+	0xC000C000,0xC080C080,0xC000C000,0xC080C080,0xDE20C000,0xDEA0C080,0xDE20C000,0xDEA0C080,
+	0xC000C000,0xC080C080,0xC000C000,0xC080C080,0xDE20C000,0xDEA0C080,0xDE20C000,0xDEA0C080,
+	0xC000C000,0xC080C080,0xC000C000,0xC080C080,0xDE20C000,0xDEA0C080,0xDE20C000,0xDEA0C080,
+	0xC000C000,0xC080C080,0xC000C000,0xC080C080,0xDE20C000,0xDEA0C080,0xDE20C000,0xDEA0C080,
+	0xC000C000,0xC080C080,0xC000C000,0xC080C080,0xDE20C000,0xDEA0C080,0xDE20C000,0xDEA0C080,
+	0xC000C000,0xC080C080,0xC000C000,0xC080C080,0xDE20C000,0xDEA0C080,0xDE20C000,0xDEA0C080,
+	0xC000C000,0xC080C080,0xC000C000,0xC080C080,0xDE20C000,0xDEA0C080,0xDE20C000,0xDEA0C080,
+	0xC000C000,0xC080C080,0xC000C000,0xC080C080,0xDE20C000,0xDEA0C080,0xDE20C000,0xDEA0C080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0xC000C000,0xC080C080,0xC000C000,0xC080C080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0xC000C000,0xC080C080,0xC000C000,0xC080C080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0xC000C000,0xC080C080,0xC000C000,0xC080C080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0xC000C000,0xC080C080,0xC000C000,0xC080C080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0xC000C000,0xC080C080,0xC000C000,0xC080C080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0xC000C000,0xC080C080,0xC000C000,0xC080C080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0xC000C000,0xC080C080,0xC000C000,0xC080C080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0xC000C000,0xC080C080,0xC000C000,0xC080C080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0xC000C000,0xC080C080,0xC000C000,0xC080C080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0xC000C000,0xC080C080,0xC000C000,0xC080C080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0xC000C000,0xC080C080,0xC000C000,0xC080C080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0xC000C000,0xC080C080,0xC000C000,0xC080C080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0xC000C000,0xC080C080,0xC000C000,0xC080C080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0xC000C000,0xC080C080,0xC000C000,0xC080C080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0xC000C000,0xC080C080,0xC000C000,0xC080C080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0xC000C000,0xC080C080,0xC000C000,0xC080C080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0xC000C000,0xC080C080,0xC000C000,0xC080C080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0xC000C000,0xC080C080,0xC000C000,0xC080C080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0xC000C000,0xC080C080,0xC000C000,0xC080C080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0xC000C000,0xC080C080,0xC000C000,0xC080C080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0xC000C000,0xC080C080,0xC000C000,0xC080C080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0xC000C000,0xC080C080,0xC000C000,0xC080C080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0xC000C000,0xC080C080,0xC000C000,0xC080C080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0xC000C000,0xC080C080,0xC000C000,0xC080C080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0xC000C000,0xC080C080,0xC000C000,0xC080C080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0xC000C000,0xC080C080,0xC000C000,0xC080C080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0xC000C000,0xC080C080,0xC000C000,0xC080C080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0xC000C000,0xC080C080,0xC000C000,0xC080C080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0xC000C000,0xC080C080,0xC000C000,0xC080C080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0xC000C000,0xC080C080,0xC000C000,0xC080C080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0xC000C000,0xC080C080,0xC000C000,0xC080C080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0xC000C000,0xC080C080,0xC000C000,0xC080C080,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0xDE30C000,0xDE30C000,0xDE30C000,0xDE30C000,0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEA0,
+	0xDE30C000,0xDE30C000,0xDE30C000,0xDE30C000,0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEA0,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0xDE30C000,0xDE30C000,0xDE30C000,0xDE30C000,0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEA0,
+	0xDE30C000,0xDE30C000,0xDE30C000,0xDE30C000,0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEA0,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0xDE30C000,0xDE30C000,0xDE30C000,0xDE30C000,0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEA0,
+	0xDE30C000,0xDE30C000,0xDE30C000,0xDE30C000,0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEA0,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0xDE30C000,0xDE30C000,0xDE30C000,0xDE30C000,0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEA0,
+	0xDE30C000,0xDE30C000,0xDE30C000,0xDE30C000,0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEA0,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0xDE30C000,0xDE30C000,0xDE30C000,0xDE30C000,0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEA0,
+	0xDE30C000,0xDE30C000,0xDE30C000,0xDE30C000,0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEA0,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0xDE30C000,0xDE30C000,0xDE30C000,0xDE30C000,0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEA0,
+	0xDE30C000,0xDE30C000,0xDE30C000,0xDE30C000,0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEA0,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0xDE30C000,0xDE30C000,0xDE30C000,0xDE30C000,0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEA0,
+	0xDE30C000,0xDE30C000,0xDE30C000,0xDE30C000,0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEA0,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0xDE30C000,0xDE30C000,0xDE30C000,0xDE30C000,0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEA0,
+	0xDE30C000,0xDE30C000,0xDE30C000,0xDE30C000,0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEA0,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0xC000DE20,0xDE20DE20,0xC000DE20,0xDE20DE20,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0xC000DE20,0xDE20DE20,0xC000DE20,0xDE20DE20,
+	0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,
+	0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0xC000DE20,0xDE20DE20,0xC000DE20,0xDE20DE20,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0xC000DE20,0xDE20DE20,0xC000DE20,0xDE20DE20,
+	0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,
+	0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0xC000DE20,0xDE20DE20,0xC000DE20,0xDE20DE20,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0xC000DE20,0xDE20DE20,0xC000DE20,0xDE20DE20,
+	0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,
+	0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0xC000DE20,0xDE20DE20,0xC000DE20,0xDE20DE20,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0xC000DE20,0xDE20DE20,0xC000DE20,0xDE20DE20,
+	0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,
+	0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0xC000DE20,0xDE20DE20,0xC000DE20,0xDE20DE20,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0xC000DE20,0xDE20DE20,0xC000DE20,0xDE20DE20,
+	0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,
+	0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0xC000DE20,0xDE20DE20,0xC000DE20,0xDE20DE20,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0xC000DE20,0xDE20DE20,0xC000DE20,0xDE20DE20,
+	0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,
+	0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0xC000DE20,0xDE20DE20,0xC000DE20,0xDE20DE20,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0xC000DE20,0xDE20DE20,0xC000DE20,0xDE20DE20,
+	0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,
+	0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0xC000DE20,0xDE20DE20,0xC000DE20,0xDE20DE20,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0xC000DE20,0xDE20DE20,0xC000DE20,0xDE20DE20,
+	0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,
+	0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,
+	0x00000000,0x80008000,0x00000000,0x80008000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,
+	0x40004000,0xDE20C000,0x40004000,0xDE20C000,0xC080C080,0xDEA0C080,0xC080C080,0xDEA0C080,
+	0x40004000,0xDE20C000,0x40004000,0xDE20C000,0xC080C080,0xDEA0C080,0xC080C080,0xDEA0C080,
+	0x40004000,0xDE20C000,0x40004000,0xDE20C000,0xC080C080,0xDEA0C080,0xC080C080,0xDEA0C080,
+	0x40004000,0xDE20C000,0x40004000,0xDE20C000,0xC080C080,0xDEA0C080,0xC080C080,0xDEA0C080,
+	0xC000C000,0xDE20C000,0xC000C000,0xDE20C000,0xC080C080,0xDEA0C080,0xC080C080,0xDEA0C080,
+	0xC000C000,0xDE20C000,0xC000C000,0xDE20C000,0xC080C080,0xDEA0C080,0xC080C080,0xDEA0C080,
+	0xC000C000,0xDE20C000,0xC000C000,0xDE20C000,0xC080C080,0xDEA0C080,0xC080C080,0xDEA0C080,
+	0xC000C000,0xDE20C000,0xC000C000,0xDE20C000,0xC080C080,0xDEA0C080,0xC080C080,0xDEA0C080,
+	0x40004000,0xDE20C000,0x40004000,0xDE20C000,0xC080C080,0xDEA0C080,0xC080C080,0xDEA0C080,
+	0x40004000,0xDE20C000,0x40004000,0xDE20C000,0xC080C080,0xDEA0C080,0xC080C080,0xDEA0C080,
+	0x40004000,0xDE20C000,0x40004000,0xDE20C000,0xC080C080,0xDEA0C080,0xC080C080,0xDEA0C080,
+	0x40004000,0xDE20C000,0x40004000,0xDE20C000,0xC080C080,0xDEA0C080,0xC080C080,0xDEA0C080,
+	0xC000C000,0xDE20C000,0xC000C000,0xDE20C000,0xC080C080,0xDEA0C080,0xC080C080,0xDEA0C080,
+	0xC000C000,0xDE20C000,0xC000C000,0xDE20C000,0xC080C080,0xDEA0C080,0xC080C080,0xDEA0C080,
+	0xC000C000,0xDE20C000,0xC000C000,0xDE20C000,0xC080C080,0xDEA0C080,0xC080C080,0xDEA0C080,
+	0xC000C000,0xDE20C000,0xC000C000,0xDE20C000,0xC080C080,0xDEA0C080,0xC080C080,0xDEA0C080,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x40004000,0xC000C000,0x40004000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x40004000,0xC000C000,0x40004000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x40004000,0xC000C000,0x40004000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x40004000,0xC000C000,0x40004000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x40004000,0xC000C000,0x40004000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x40004000,0xC000C000,0x40004000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x40004000,0xC000C000,0x40004000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x40004000,0xC000C000,0x40004000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x40004000,0xC000C000,0x40004000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x40004000,0xC000C000,0x40004000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x40004000,0xC000C000,0x40004000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x40004000,0xC000C000,0x40004000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x40004000,0xC000C000,0x40004000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x40004000,0xC000C000,0x40004000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x40004000,0xC000C000,0x40004000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x40004000,0xC000C000,0x40004000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0xDEA0DEA0,0x00000000,0xDEA0DEA0,0x00000000,0xDEA0DEA0,0x00000000,0xDEA0DEA0,
+	0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,
+	0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0xDE70C050,0xDEF0DEF0,0xDE70C050,0xDEF0DEF0,0xDE70C050,0xDEF0DEF0,0xDE70C050,0xDEF0DEF0,
+	0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,
+	0xDE70C050,0xDEF0DEF0,0xDE70C050,0xDEF0DEF0,0xDE70C050,0xDEF0DEF0,0xDE70C050,0xDEF0DEF0,
+	0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,
+	0x40404040,0xDEE0DEE0,0x40404040,0xDEE0DEE0,0x40404040,0xDEE0DEE0,0x40404040,0xDEE0DEE0,
+	0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,
+	0xC040C040,0xDEE0DEE0,0xC040C040,0xDEE0DEE0,0xC040C040,0xDEE0DEE0,0xC040C040,0xDEE0DEE0,
+	0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,
+	0xDE70C050,0xDEF0DEF0,0xDE70C050,0xDEF0DEF0,0xDE70C050,0xDEF0DEF0,0xDE70C050,0xDEF0DEF0,
+	0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,
+	0xDE70C050,0xDEF0DEF0,0xDE70C050,0xDEF0DEF0,0xDE70C050,0xDEF0DEF0,0xDE70C050,0xDEF0DEF0,
+	0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,
+	0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,
+	0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,
+	0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0xDE70C050,0xDEF0DEF0,0xDE70C050,0xDEF0DEF0,0xDE70C050,0xDEF0DEF0,0xDE70C050,0xDEF0DEF0,
+	0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,
+	0xDE70C050,0xDEF0DEF0,0xDE70C050,0xDEF0DEF0,0xDE70C050,0xDEF0DEF0,0xDE70C050,0xDEF0DEF0,
+	0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,
+	0xC040C040,0xDEE0DEE0,0xC040C040,0xDEE0DEE0,0xC040C040,0xDEE0DEE0,0xC040C040,0xDEE0DEE0,
+	0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,
+	0xC040C040,0xDEE0DEE0,0xC040C040,0xDEE0DEE0,0xC040C040,0xDEE0DEE0,0xC040C040,0xDEE0DEE0,
+	0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,
+	0xDE70C050,0xDEF0DEF0,0xDE70C050,0xDEF0DEF0,0xDE70C050,0xDEF0DEF0,0xDE70C050,0xDEF0DEF0,
+	0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,
+	0xDE70C050,0xDEF0DEF0,0xDE70C050,0xDEF0DEF0,0xDE70C050,0xDEF0DEF0,0xDE70C050,0xDEF0DEF0,
+	0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,
+	0x00000000,0xDEA0DEA0,0x00000000,0xDEA0DEA0,0x00000000,0xDEA0DEA0,0x00000000,0xDEA0DEA0,
+	0xC000DE20,0xDEA0DEA0,0xC000DE20,0xDEA0DEA0,0xC000DE20,0xDEA0DEA0,0xC000DE20,0xDEA0DEA0,
+	0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,
+	0xC000DE20,0xDEA0DEA0,0xC000DE20,0xDEA0DEA0,0xC000DE20,0xDEA0DEA0,0xC000DE20,0xDEA0DEA0,
+	0xDE20C000,0xDEA0DEA0,0xDE20C000,0xDEA0DEA0,0xDE20C000,0xDEA0DEA0,0xDE20C000,0xDEA0DEA0,
+	0xDE20DE20,0xDEA0DEA0,0xDE20DE20,0xDEA0DEA0,0xDE20DE20,0xDEA0DEA0,0xDE20DE20,0xDEA0DEA0,
+	0xDE20C000,0xDEA0DEA0,0xDE20C000,0xDEA0DEA0,0xDE20C000,0xDEA0DEA0,0xDE20C000,0xDEA0DEA0,
+	0xDE20DE20,0xDEA0DEA0,0xDE20DE20,0xDEA0DEA0,0xDE20DE20,0xDEA0DEA0,0xDE20DE20,0xDEA0DEA0,
+	0x00000000,0xDEA0DEA0,0x00000000,0xDEA0DEA0,0x00000000,0xDEA0DEA0,0x00000000,0xDEA0DEA0,
+	0xC000DE20,0xDEA0DEA0,0xC000DE20,0xDEA0DEA0,0xC000DE20,0xDEA0DEA0,0xC000DE20,0xDEA0DEA0,
+	0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,
+	0xC000DE20,0xDEA0DEA0,0xC000DE20,0xDEA0DEA0,0xC000DE20,0xDEA0DEA0,0xC000DE20,0xDEA0DEA0,
+	0xDE20C000,0xDEA0DEA0,0xDE20C000,0xDEA0DEA0,0xDE20C000,0xDEA0DEA0,0xDE20C000,0xDEA0DEA0,
+	0xDE20DE20,0xDEA0DEA0,0xDE20DE20,0xDEA0DEA0,0xDE20DE20,0xDEA0DEA0,0xDE20DE20,0xDEA0DEA0,
+	0xDE20C000,0xDEA0DEA0,0xDE20C000,0xDEA0DEA0,0xDE20C000,0xDEA0DEA0,0xDE20C000,0xDEA0DEA0,
+	0xDE20DE20,0xDEA0DEA0,0xDE20DE20,0xDEA0DEA0,0xDE20DE20,0xDEA0DEA0,0xDE20DE20,0xDEA0DEA0,
+	0x00000000,0xDEA0DEA0,0x00000000,0xDEA0DEA0,0x00000000,0xDEA0DEA0,0x00000000,0xDEA0DEA0,
+	0xC000DE20,0xDEA0DEA0,0xC000DE20,0xDEA0DEA0,0xC000DE20,0xDEA0DEA0,0xC000DE20,0xDEA0DEA0,
+	0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,
+	0xC000DE20,0xDEA0DEA0,0xC000DE20,0xDEA0DEA0,0xC000DE20,0xDEA0DEA0,0xC000DE20,0xDEA0DEA0,
+	0xDE20C000,0xDEA0DEA0,0xDE20C000,0xDEA0DEA0,0xDE20C000,0xDEA0DEA0,0xDE20C000,0xDEA0DEA0,
+	0xDE20DE20,0xDEA0DEA0,0xDE20DE20,0xDEA0DEA0,0xDE20DE20,0xDEA0DEA0,0xDE20DE20,0xDEA0DEA0,
+	0xDE20C000,0xDEA0DEA0,0xDE20C000,0xDEA0DEA0,0xDE20C000,0xDEA0DEA0,0xDE20C000,0xDEA0DEA0,
+	0xDE20DE20,0xDEA0DEA0,0xDE20DE20,0xDEA0DEA0,0xDE20DE20,0xDEA0DEA0,0xDE20DE20,0xDEA0DEA0,
+	0x00000000,0xDEA0DEA0,0x00000000,0xDEA0DEA0,0x00000000,0xDEA0DEA0,0x00000000,0xDEA0DEA0,
+	0xC000DE20,0xDEA0DEA0,0xC000DE20,0xDEA0DEA0,0xC000DE20,0xDEA0DEA0,0xC000DE20,0xDEA0DEA0,
+	0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,
+	0xC000DE20,0xDEA0DEA0,0xC000DE20,0xDEA0DEA0,0xC000DE20,0xDEA0DEA0,0xC000DE20,0xDEA0DEA0,
+	0xDE20C000,0xDEA0DEA0,0xDE20C000,0xDEA0DEA0,0xDE20C000,0xDEA0DEA0,0xDE20C000,0xDEA0DEA0,
+	0xDE20DE20,0xDEA0DEA0,0xDE20DE20,0xDEA0DEA0,0xDE20DE20,0xDEA0DEA0,0xDE20DE20,0xDEA0DEA0,
+	0xDE20C000,0xDEA0DEA0,0xDE20C000,0xDEA0DEA0,0xDE20C000,0xDEA0DEA0,0xDE20C000,0xDEA0DEA0,
+	0xDE20DE20,0xDEA0DEA0,0xDE20DE20,0xDEA0DEA0,0xDE20DE20,0xDEA0DEA0,0xDE20DE20,0xDEA0DEA0,
+	0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,
+	0xDE20C000,0xDEA0C080,0xDE20C000,0xDEA0C080,0xDE20C000,0xDEA0C080,0xDE20C000,0xDEA0C080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,
+	0xDE20C000,0xDEA0C080,0xDE20C000,0xDEA0C080,0xDE20C000,0xDEA0C080,0xDE20C000,0xDEA0C080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,
+	0xDE20C000,0xDEA0C080,0xDE20C000,0xDEA0C080,0xDE20C000,0xDEA0C080,0xDE20C000,0xDEA0C080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,
+	0xDE20C000,0xDEA0C080,0xDE20C000,0xDEA0C080,0xDE20C000,0xDEA0C080,0xDE20C000,0xDEA0C080,
+	0x40004000,0xC080C080,0x40004000,0xC080C080,0x40004000,0xC080C080,0x40004000,0xC080C080,
+	0xDE20C000,0xDEA0C080,0xDE20C000,0xDEA0C080,0xDE20C000,0xDEA0C080,0xDE20C000,0xDEA0C080,
+	0x40004000,0xC080C080,0x40004000,0xC080C080,0x40004000,0xC080C080,0x40004000,0xC080C080,
+	0xDE20C000,0xDEA0C080,0xDE20C000,0xDEA0C080,0xDE20C000,0xDEA0C080,0xDE20C000,0xDEA0C080,
+	0x40004000,0xC080C080,0x40004000,0xC080C080,0x40004000,0xC080C080,0x40004000,0xC080C080,
+	0xDE20C000,0xDEA0C080,0xDE20C000,0xDEA0C080,0xDE20C000,0xDEA0C080,0xDE20C000,0xDEA0C080,
+	0x40004000,0xC080C080,0x40004000,0xC080C080,0x40004000,0xC080C080,0x40004000,0xC080C080,
+	0xDE20C000,0xDEA0C080,0xDE20C000,0xDEA0C080,0xDE20C000,0xDEA0C080,0xDE20C000,0xDEA0C080,
+	0x80008000,0x80808080,0x80008000,0x80808080,0x80008000,0x80808080,0x80008000,0x80808080,
+	0xDE20C000,0xDEA0C080,0xDE20C000,0xDEA0C080,0xDE20C000,0xDEA0C080,0xDE20C000,0xDEA0C080,
+	0x80008000,0x80808080,0x80008000,0x80808080,0x80008000,0x80808080,0x80008000,0x80808080,
+	0xDE20C000,0xDEA0C080,0xDE20C000,0xDEA0C080,0xDE20C000,0xDEA0C080,0xDE20C000,0xDEA0C080,
+	0x80008000,0x80808080,0x80008000,0x80808080,0x80008000,0x80808080,0x80008000,0x80808080,
+	0xDE20C000,0xDEA0C080,0xDE20C000,0xDEA0C080,0xDE20C000,0xDEA0C080,0xDE20C000,0xDEA0C080,
+	0x80008000,0x80808080,0x80008000,0x80808080,0x80008000,0x80808080,0x80008000,0x80808080,
+	0xDE20C000,0xDEA0C080,0xDE20C000,0xDEA0C080,0xDE20C000,0xDEA0C080,0xDE20C000,0xDEA0C080,
+	0xC000C000,0xC080C080,0xC000C000,0xC080C080,0xC000C000,0xC080C080,0xC000C000,0xC080C080,
+	0xDE20C000,0xDEA0C080,0xDE20C000,0xDEA0C080,0xDE20C000,0xDEA0C080,0xDE20C000,0xDEA0C080,
+	0xC000C000,0xC080C080,0xC000C000,0xC080C080,0xC000C000,0xC080C080,0xC000C000,0xC080C080,
+	0xDE20C000,0xDEA0C080,0xDE20C000,0xDEA0C080,0xDE20C000,0xDEA0C080,0xDE20C000,0xDEA0C080,
+	0xC000C000,0xC080C080,0xC000C000,0xC080C080,0xC000C000,0xC080C080,0xC000C000,0xC080C080,
+	0xDE20C000,0xDEA0C080,0xDE20C000,0xDEA0C080,0xDE20C000,0xDEA0C080,0xDE20C000,0xDEA0C080,
+	0xC000C000,0xC080C080,0xC000C000,0xC080C080,0xC000C000,0xC080C080,0xC000C000,0xC080C080,
+	0xDE20C000,0xDEA0C080,0xDE20C000,0xDEA0C080,0xDE20C000,0xDEA0C080,0xDE20C000,0xDEA0C080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,
+	0xC000C000,0xC080C080,0xC000C000,0xC080C080,0xC000C000,0xC080C080,0xC000C000,0xC080C080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,
+	0xC000C000,0xC080C080,0xC000C000,0xC080C080,0xC000C000,0xC080C080,0xC000C000,0xC080C080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,
+	0xC000C000,0xC080C080,0xC000C000,0xC080C080,0xC000C000,0xC080C080,0xC000C000,0xC080C080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,
+	0xC000C000,0xC080C080,0xC000C000,0xC080C080,0xC000C000,0xC080C080,0xC000C000,0xC080C080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,
+	0xC000C000,0xC080C080,0xC000C000,0xC080C080,0xC000C000,0xC080C080,0xC000C000,0xC080C080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,
+	0xC000C000,0xC080C080,0xC000C000,0xC080C080,0xC000C000,0xC080C080,0xC000C000,0xC080C080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,
+	0xC000C000,0xC080C080,0xC000C000,0xC080C080,0xC000C000,0xC080C080,0xC000C000,0xC080C080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,
+	0xC000C000,0xC080C080,0xC000C000,0xC080C080,0xC000C000,0xC080C080,0xC000C000,0xC080C080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,
+	0xC000C000,0xC080C080,0xC000C000,0xC080C080,0xC000C000,0xC080C080,0xC000C000,0xC080C080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,
+	0xC000C000,0xC080C080,0xC000C000,0xC080C080,0xC000C000,0xC080C080,0xC000C000,0xC080C080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,
+	0xC000C000,0xC080C080,0xC000C000,0xC080C080,0xC000C000,0xC080C080,0xC000C000,0xC080C080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,
+	0xC000C000,0xC080C080,0xC000C000,0xC080C080,0xC000C000,0xC080C080,0xC000C000,0xC080C080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,
+	0xC000C000,0xC080C080,0xC000C000,0xC080C080,0xC000C000,0xC080C080,0xC000C000,0xC080C080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,
+	0xC000C000,0xC080C080,0xC000C000,0xC080C080,0xC000C000,0xC080C080,0xC000C000,0xC080C080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,
+	0xC000C000,0xC080C080,0xC000C000,0xC080C080,0xC000C000,0xC080C080,0xC000C000,0xC080C080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,
+	0xC000C000,0xC080C080,0xC000C000,0xC080C080,0xC000C000,0xC080C080,0xC000C000,0xC080C080,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,
+	0x40004000,0xDE20C000,0x40004000,0xDE20C000,0x40004000,0xDE20C000,0x40004000,0xDE20C000,
+	0xC080C080,0xDEA0C080,0xC080C080,0xDEA0C080,0xC080C080,0xDEA0C080,0xC080C080,0xDEA0C080,
+	0xC000C000,0xDE20C000,0xC000C000,0xDE20C000,0xC000C000,0xDE20C000,0xC000C000,0xDE20C000,
+	0xC080C080,0xDEA0C080,0xC080C080,0xDEA0C080,0xC080C080,0xDEA0C080,0xC080C080,0xDEA0C080,
+	0x40004000,0xDE20C000,0x40004000,0xDE20C000,0x40004000,0xDE20C000,0x40004000,0xDE20C000,
+	0xC080C080,0xDEA0C080,0xC080C080,0xDEA0C080,0xC080C080,0xDEA0C080,0xC080C080,0xDEA0C080,
+	0xC000C000,0xDE20C000,0xC000C000,0xDE20C000,0xC000C000,0xDE20C000,0xC000C000,0xDE20C000,
+	0xC080C080,0xDEA0C080,0xC080C080,0xDEA0C080,0xC080C080,0xDEA0C080,0xC080C080,0xDEA0C080,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,
+	0x40004000,0xDE20C000,0x40004000,0xDE20C000,0x40004000,0xDE20C000,0x40004000,0xDE20C000,
+	0xC080C080,0xDEA0C080,0xC080C080,0xDEA0C080,0xC080C080,0xDEA0C080,0xC080C080,0xDEA0C080,
+	0xC000C000,0xDE20C000,0xC000C000,0xDE20C000,0xC000C000,0xDE20C000,0xC000C000,0xDE20C000,
+	0xC080C080,0xDEA0C080,0xC080C080,0xDEA0C080,0xC080C080,0xDEA0C080,0xC080C080,0xDEA0C080,
+	0x40004000,0xDE20C000,0x40004000,0xDE20C000,0x40004000,0xDE20C000,0x40004000,0xDE20C000,
+	0xC080C080,0xDEA0C080,0xC080C080,0xDEA0C080,0xC080C080,0xDEA0C080,0xC080C080,0xDEA0C080,
+	0xC000C000,0xDE20C000,0xC000C000,0xDE20C000,0xC000C000,0xDE20C000,0xC000C000,0xDE20C000,
+	0xC080C080,0xDEA0C080,0xC080C080,0xDEA0C080,0xC080C080,0xDEA0C080,0xC080C080,0xDEA0C080,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x40004000,0xC000C000,0x40004000,0xC000C000,0x40004000,0xC000C000,0x40004000,0xC000C000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x40004000,0xC000C000,0x40004000,0xC000C000,0x40004000,0xC000C000,0x40004000,0xC000C000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x40004000,0xC000C000,0x40004000,0xC000C000,0x40004000,0xC000C000,0x40004000,0xC000C000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x40004000,0xC000C000,0x40004000,0xC000C000,0x40004000,0xC000C000,0x40004000,0xC000C000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x40004000,0xC000C000,0x40004000,0xC000C000,0x40004000,0xC000C000,0x40004000,0xC000C000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x40004000,0xC000C000,0x40004000,0xC000C000,0x40004000,0xC000C000,0x40004000,0xC000C000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x40004000,0xC000C000,0x40004000,0xC000C000,0x40004000,0xC000C000,0x40004000,0xC000C000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x40004000,0xC000C000,0x40004000,0xC000C000,0x40004000,0xC000C000,0x40004000,0xC000C000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0xDE30C000,0xDE30C000,0xDE30C000,0xDE30C000,0xDE30C000,0xDE30C000,0xDE30C000,0xDE30C000,
+	0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEA0,
+	0xDE30C000,0xDE30C000,0xDE30C000,0xDE30C000,0xDE30C000,0xDE30C000,0xDE30C000,0xDE30C000,
+	0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEA0,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0xDE30C000,0xDE30C000,0xDE30C000,0xDE30C000,0xDE30C000,0xDE30C000,0xDE30C000,0xDE30C000,
+	0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEA0,
+	0xDE30C000,0xDE30C000,0xDE30C000,0xDE30C000,0xDE30C000,0xDE30C000,0xDE30C000,0xDE30C000,
+	0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEA0,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0xDE30C000,0xDE30C000,0xDE30C000,0xDE30C000,0xDE30C000,0xDE30C000,0xDE30C000,0xDE30C000,
+	0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEA0,
+	0xDE30C000,0xDE30C000,0xDE30C000,0xDE30C000,0xDE30C000,0xDE30C000,0xDE30C000,0xDE30C000,
+	0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEA0,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0xDE30C000,0xDE30C000,0xDE30C000,0xDE30C000,0xDE30C000,0xDE30C000,0xDE30C000,0xDE30C000,
+	0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEA0,
+	0xDE30C000,0xDE30C000,0xDE30C000,0xDE30C000,0xDE30C000,0xDE30C000,0xDE30C000,0xDE30C000,
+	0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEA0,0xDEB0DEA0,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0xC000DE20,0xDE20DE20,0xC000DE20,0xDE20DE20,0xC000DE20,0xDE20DE20,0xC000DE20,0xDE20DE20,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0xC000DE20,0xDE20DE20,0xC000DE20,0xDE20DE20,0xC000DE20,0xDE20DE20,0xC000DE20,0xDE20DE20,
+	0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,
+	0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0xC000DE20,0xDE20DE20,0xC000DE20,0xDE20DE20,0xC000DE20,0xDE20DE20,0xC000DE20,0xDE20DE20,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0xC000DE20,0xDE20DE20,0xC000DE20,0xDE20DE20,0xC000DE20,0xDE20DE20,0xC000DE20,0xDE20DE20,
+	0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,
+	0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0xC000DE20,0xDE20DE20,0xC000DE20,0xDE20DE20,0xC000DE20,0xDE20DE20,0xC000DE20,0xDE20DE20,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0xC000DE20,0xDE20DE20,0xC000DE20,0xDE20DE20,0xC000DE20,0xDE20DE20,0xC000DE20,0xDE20DE20,
+	0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,
+	0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0xC000DE20,0xDE20DE20,0xC000DE20,0xDE20DE20,0xC000DE20,0xDE20DE20,0xC000DE20,0xDE20DE20,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0xC000DE20,0xDE20DE20,0xC000DE20,0xDE20DE20,0xC000DE20,0xDE20DE20,0xC000DE20,0xDE20DE20,
+	0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,
+	0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,0x80808080,0xDEA0C080,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0xDEA0DEA0,0x00000000,0xDEA0DEA0,0x00000000,0xDEA0DEA0,0x00000000,0xDEA0DEA0,
+	0x00000000,0xDEA0DEA0,0x00000000,0xDEA0DEA0,0x00000000,0xDEA0DEA0,0x00000000,0xDEA0DEA0,
+	0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,
+	0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,
+	0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,
+	0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,
+	0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,
+	0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,
+	0x00000000,0xDEA0DEA0,0x00000000,0xDEA0DEA0,0x00000000,0xDEA0DEA0,0x00000000,0xDEA0DEA0,
+	0x00000000,0xDEA0DEA0,0x00000000,0xDEA0DEA0,0x00000000,0xDEA0DEA0,0x00000000,0xDEA0DEA0,
+	0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,
+	0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,
+	0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,
+	0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,
+	0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,
+	0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,
+	0x00000000,0xDEA0DEA0,0x00000000,0xDEA0DEA0,0x00000000,0xDEA0DEA0,0x00000000,0xDEA0DEA0,
+	0x00000000,0xDEA0DEA0,0x00000000,0xDEA0DEA0,0x00000000,0xDEA0DEA0,0x00000000,0xDEA0DEA0,
+	0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,
+	0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,
+	0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,
+	0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,
+	0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,
+	0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,
+	0x00000000,0xDEA0DEA0,0x00000000,0xDEA0DEA0,0x00000000,0xDEA0DEA0,0x00000000,0xDEA0DEA0,
+	0x00000000,0xDEA0DEA0,0x00000000,0xDEA0DEA0,0x00000000,0xDEA0DEA0,0x00000000,0xDEA0DEA0,
+	0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,
+	0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,
+	0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,
+	0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,
+	0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,
+	0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,
+	0x00000000,0xDEA0DEA0,0x00000000,0xDEA0DEA0,0x00000000,0xDEA0DEA0,0x00000000,0xDEA0DEA0,
+	0x00000000,0xDEA0DEA0,0x00000000,0xDEA0DEA0,0x00000000,0xDEA0DEA0,0x00000000,0xDEA0DEA0,
+	0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,
+	0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,
+	0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,
+	0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,
+	0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,
+	0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,
+	0x00000000,0xDEA0DEA0,0x00000000,0xDEA0DEA0,0x00000000,0xDEA0DEA0,0x00000000,0xDEA0DEA0,
+	0x00000000,0xDEA0DEA0,0x00000000,0xDEA0DEA0,0x00000000,0xDEA0DEA0,0x00000000,0xDEA0DEA0,
+	0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,
+	0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,
+	0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,
+	0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,
+	0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,
+	0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,
+	0x00000000,0xDEA0DEA0,0x00000000,0xDEA0DEA0,0x00000000,0xDEA0DEA0,0x00000000,0xDEA0DEA0,
+	0x00000000,0xDEA0DEA0,0x00000000,0xDEA0DEA0,0x00000000,0xDEA0DEA0,0x00000000,0xDEA0DEA0,
+	0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,
+	0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,
+	0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,
+	0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,
+	0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,
+	0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,
+	0x00000000,0xDEA0DEA0,0x00000000,0xDEA0DEA0,0x00000000,0xDEA0DEA0,0x00000000,0xDEA0DEA0,
+	0x00000000,0xDEA0DEA0,0x00000000,0xDEA0DEA0,0x00000000,0xDEA0DEA0,0x00000000,0xDEA0DEA0,
+	0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,
+	0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,
+	0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,
+	0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,
+	0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,
+	0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,0x80008000,0xDEA0DEA0,
+	0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,
+	0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,0x00000000,0x80808080,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,0x80008000,0xDE20C000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,0x00000000,0xDE20C000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,0x00000000,0x80008000,
+	0x00000000,0x00000000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x00000000,0x00000000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x40404040,0x40404040,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,
+	0x40404040,0x40404040,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,
+	0xC040C040,0xC040C040,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,
+	0xC040C040,0xC040C040,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,
+	0xC050DE70,0xC050DE70,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,
+	0xC050DE70,0xC050DE70,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,
+	0xC050DE70,0xC050DE70,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,
+	0xC050DE70,0xC050DE70,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,
+	0xC050DE70,0xC050DE70,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,
+	0xC050DE70,0xC050DE70,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,
+	0xC050DE70,0xC050DE70,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,
+	0xC050DE70,0xC050DE70,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,
+	0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0xC040C040,0xC040C040,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,
+	0xC040C040,0xC040C040,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,
+	0xC040C040,0xC040C040,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,
+	0xC040C040,0xC040C040,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,
+	0xC050DE70,0xC050DE70,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,
+	0xC050DE70,0xC050DE70,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,
+	0xC050DE70,0xC050DE70,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,
+	0xC050DE70,0xC050DE70,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,
+	0xC050DE70,0xC050DE70,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,
+	0xC050DE70,0xC050DE70,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,
+	0xC050DE70,0xC050DE70,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,
+	0xC050DE70,0xC050DE70,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,
+	0x00000000,0x00000000,0x80808080,0x80808080,0xC000DE20,0xC000DE20,0xC080DEA0,0xC080DEA0,
+	0x00000000,0x00000000,0x80808080,0x80808080,0xC000DE20,0xC000DE20,0xC080DEA0,0xC080DEA0,
+	0x80008000,0x80008000,0x80808080,0x80808080,0xC000DE20,0xC000DE20,0xC080DEA0,0xC080DEA0,
+	0x80008000,0x80008000,0x80808080,0x80808080,0xC000DE20,0xC000DE20,0xC080DEA0,0xC080DEA0,
+	0x40004000,0x40004000,0xC080C080,0xC080C080,0xC000DE20,0xC000DE20,0xC080DEA0,0xC080DEA0,
+	0x40004000,0x40004000,0xC080C080,0xC080C080,0xC000DE20,0xC000DE20,0xC080DEA0,0xC080DEA0,
+	0xC000C000,0xC000C000,0xC080C080,0xC080C080,0xC000DE20,0xC000DE20,0xC080DEA0,0xC080DEA0,
+	0xC000C000,0xC000C000,0xC080C080,0xC080C080,0xC000DE20,0xC000DE20,0xC080DEA0,0xC080DEA0,
+	0x00000000,0x00000000,0x80808080,0x80808080,0xC000DE20,0xC000DE20,0xC080DEA0,0xC080DEA0,
+	0x00000000,0x00000000,0x80808080,0x80808080,0xC000DE20,0xC000DE20,0xC080DEA0,0xC080DEA0,
+	0x80008000,0x80008000,0x80808080,0x80808080,0xC000DE20,0xC000DE20,0xC080DEA0,0xC080DEA0,
+	0x80008000,0x80008000,0x80808080,0x80808080,0xC000DE20,0xC000DE20,0xC080DEA0,0xC080DEA0,
+	0x40004000,0x40004000,0xC080C080,0xC080C080,0xC000DE20,0xC000DE20,0xC080DEA0,0xC080DEA0,
+	0x40004000,0x40004000,0xC080C080,0xC080C080,0xC000DE20,0xC000DE20,0xC080DEA0,0xC080DEA0,
+	0xC000C000,0xC000C000,0xC080C080,0xC080C080,0xC000DE20,0xC000DE20,0xC080DEA0,0xC080DEA0,
+	0xC000C000,0xC000C000,0xC080C080,0xC080C080,0xC000DE20,0xC000DE20,0xC080DEA0,0xC080DEA0,
+	0x00000000,0x00000000,0x80808080,0x80808080,0xC000DE20,0xC000DE20,0xC080DEA0,0xC080DEA0,
+	0x00000000,0x00000000,0x80808080,0x80808080,0xC000DE20,0xC000DE20,0xC080DEA0,0xC080DEA0,
+	0x80008000,0x80008000,0x80808080,0x80808080,0xC000DE20,0xC000DE20,0xC080DEA0,0xC080DEA0,
+	0x80008000,0x80008000,0x80808080,0x80808080,0xC000DE20,0xC000DE20,0xC080DEA0,0xC080DEA0,
+	0x40004000,0x40004000,0xC080C080,0xC080C080,0xC000DE20,0xC000DE20,0xC080DEA0,0xC080DEA0,
+	0x40004000,0x40004000,0xC080C080,0xC080C080,0xC000DE20,0xC000DE20,0xC080DEA0,0xC080DEA0,
+	0xC000C000,0xC000C000,0xC080C080,0xC080C080,0xC000DE20,0xC000DE20,0xC080DEA0,0xC080DEA0,
+	0xC000C000,0xC000C000,0xC080C080,0xC080C080,0xC000DE20,0xC000DE20,0xC080DEA0,0xC080DEA0,
+	0x00000000,0x00000000,0x80808080,0x80808080,0xC000DE20,0xC000DE20,0xC080DEA0,0xC080DEA0,
+	0x00000000,0x00000000,0x80808080,0x80808080,0xC000DE20,0xC000DE20,0xC080DEA0,0xC080DEA0,
+	0x80008000,0x80008000,0x80808080,0x80808080,0xC000DE20,0xC000DE20,0xC080DEA0,0xC080DEA0,
+	0x80008000,0x80008000,0x80808080,0x80808080,0xC000DE20,0xC000DE20,0xC080DEA0,0xC080DEA0,
+	0x40004000,0x40004000,0xC080C080,0xC080C080,0xC000DE20,0xC000DE20,0xC080DEA0,0xC080DEA0,
+	0x40004000,0x40004000,0xC080C080,0xC080C080,0xC000DE20,0xC000DE20,0xC080DEA0,0xC080DEA0,
+	0xC000C000,0xC000C000,0xC080C080,0xC080C080,0xC000DE20,0xC000DE20,0xC080DEA0,0xC080DEA0,
+	0xC000C000,0xC000C000,0xC080C080,0xC080C080,0xC000DE20,0xC000DE20,0xC080DEA0,0xC080DEA0,
+	0x00000000,0x00000000,0xDEA0DEA0,0xDEA0DEA0,0xDE20C000,0xDE20C000,0xDEA0DEA0,0xDEA0DEA0,
+	0x00000000,0x00000000,0xDEA0DEA0,0xDEA0DEA0,0xDE20C000,0xDE20C000,0xDEA0DEA0,0xDEA0DEA0,
+	0x00000000,0x00000000,0xDEA0DEA0,0xDEA0DEA0,0xDE20C000,0xDE20C000,0xDEA0DEA0,0xDEA0DEA0,
+	0x00000000,0x00000000,0xDEA0DEA0,0xDEA0DEA0,0xDE20C000,0xDE20C000,0xDEA0DEA0,0xDEA0DEA0,
+	0x00000000,0x00000000,0xDEA0DEA0,0xDEA0DEA0,0xDE20C000,0xDE20C000,0xDEA0DEA0,0xDEA0DEA0,
+	0x00000000,0x00000000,0xDEA0DEA0,0xDEA0DEA0,0xDE20C000,0xDE20C000,0xDEA0DEA0,0xDEA0DEA0,
+	0x00000000,0x00000000,0xDEA0DEA0,0xDEA0DEA0,0xDE20C000,0xDE20C000,0xDEA0DEA0,0xDEA0DEA0,
+	0x00000000,0x00000000,0xDEA0DEA0,0xDEA0DEA0,0xDE20C000,0xDE20C000,0xDEA0DEA0,0xDEA0DEA0,
+	0xC000DE20,0xC000DE20,0xDEA0DEA0,0xDEA0DEA0,0xDE20DE20,0xDE20DE20,0xDEA0DEA0,0xDEA0DEA0,
+	0xC000DE20,0xC000DE20,0xDEA0DEA0,0xDEA0DEA0,0xDE20DE20,0xDE20DE20,0xDEA0DEA0,0xDEA0DEA0,
+	0xC000DE20,0xC000DE20,0xDEA0DEA0,0xDEA0DEA0,0xDE20DE20,0xDE20DE20,0xDEA0DEA0,0xDEA0DEA0,
+	0xC000DE20,0xC000DE20,0xDEA0DEA0,0xDEA0DEA0,0xDE20DE20,0xDE20DE20,0xDEA0DEA0,0xDEA0DEA0,
+	0xC000DE20,0xC000DE20,0xDEA0DEA0,0xDEA0DEA0,0xDE20DE20,0xDE20DE20,0xDEA0DEA0,0xDEA0DEA0,
+	0xC000DE20,0xC000DE20,0xDEA0DEA0,0xDEA0DEA0,0xDE20DE20,0xDE20DE20,0xDEA0DEA0,0xDEA0DEA0,
+	0xC000DE20,0xC000DE20,0xDEA0DEA0,0xDEA0DEA0,0xDE20DE20,0xDE20DE20,0xDEA0DEA0,0xDEA0DEA0,
+	0xC000DE20,0xC000DE20,0xDEA0DEA0,0xDEA0DEA0,0xDE20DE20,0xDE20DE20,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0xDE20C000,0xDE20C000,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0xDE20C000,0xDE20C000,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0xDE20C000,0xDE20C000,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0xDE20C000,0xDE20C000,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0xDE20C000,0xDE20C000,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0xDE20C000,0xDE20C000,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0xDE20C000,0xDE20C000,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0xDE20C000,0xDE20C000,0xDEA0DEA0,0xDEA0DEA0,
+	0xC000DE20,0xC000DE20,0xDEA0DEA0,0xDEA0DEA0,0xDE20DE20,0xDE20DE20,0xDEA0DEA0,0xDEA0DEA0,
+	0xC000DE20,0xC000DE20,0xDEA0DEA0,0xDEA0DEA0,0xDE20DE20,0xDE20DE20,0xDEA0DEA0,0xDEA0DEA0,
+	0xC000DE20,0xC000DE20,0xDEA0DEA0,0xDEA0DEA0,0xDE20DE20,0xDE20DE20,0xDEA0DEA0,0xDEA0DEA0,
+	0xC000DE20,0xC000DE20,0xDEA0DEA0,0xDEA0DEA0,0xDE20DE20,0xDE20DE20,0xDEA0DEA0,0xDEA0DEA0,
+	0xC000DE20,0xC000DE20,0xDEA0DEA0,0xDEA0DEA0,0xDE20DE20,0xDE20DE20,0xDEA0DEA0,0xDEA0DEA0,
+	0xC000DE20,0xC000DE20,0xDEA0DEA0,0xDEA0DEA0,0xDE20DE20,0xDE20DE20,0xDEA0DEA0,0xDEA0DEA0,
+	0xC000DE20,0xC000DE20,0xDEA0DEA0,0xDEA0DEA0,0xDE20DE20,0xDE20DE20,0xDEA0DEA0,0xDEA0DEA0,
+	0xC000DE20,0xC000DE20,0xDEA0DEA0,0xDEA0DEA0,0xDE20DE20,0xDE20DE20,0xDEA0DEA0,0xDEA0DEA0,
+	0x00000000,0x00000000,0x80808080,0x80808080,0xC000C000,0xC000C000,0xC080C080,0xC080C080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0xC000C000,0xC000C000,0xC080C080,0xC080C080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0xC000C000,0xC000C000,0xC080C080,0xC080C080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0xC000C000,0xC000C000,0xC080C080,0xC080C080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0xC000C000,0xC000C000,0xC080C080,0xC080C080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0xC000C000,0xC000C000,0xC080C080,0xC080C080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0xC000C000,0xC000C000,0xC080C080,0xC080C080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0xC000C000,0xC000C000,0xC080C080,0xC080C080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0xC000C000,0xC000C000,0xC080C080,0xC080C080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0xC000C000,0xC000C000,0xC080C080,0xC080C080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0xC000C000,0xC000C000,0xC080C080,0xC080C080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0xC000C000,0xC000C000,0xC080C080,0xC080C080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0xC000C000,0xC000C000,0xC080C080,0xC080C080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0xC000C000,0xC000C000,0xC080C080,0xC080C080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0xC000C000,0xC000C000,0xC080C080,0xC080C080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0xC000C000,0xC000C000,0xC080C080,0xC080C080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0xC000C000,0xC000C000,0xC080C080,0xC080C080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0xC000C000,0xC000C000,0xC080C080,0xC080C080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0xC000C000,0xC000C000,0xC080C080,0xC080C080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0xC000C000,0xC000C000,0xC080C080,0xC080C080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0xC000C000,0xC000C000,0xC080C080,0xC080C080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0xC000C000,0xC000C000,0xC080C080,0xC080C080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0xC000C000,0xC000C000,0xC080C080,0xC080C080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0xC000C000,0xC000C000,0xC080C080,0xC080C080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0xC000C000,0xC000C000,0xC080C080,0xC080C080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0xC000C000,0xC000C000,0xC080C080,0xC080C080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0xC000C000,0xC000C000,0xC080C080,0xC080C080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0xC000C000,0xC000C000,0xC080C080,0xC080C080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0xC000C000,0xC000C000,0xC080C080,0xC080C080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0xC000C000,0xC000C000,0xC080C080,0xC080C080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0xC000C000,0xC000C000,0xC080C080,0xC080C080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0xC000C000,0xC000C000,0xC080C080,0xC080C080,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0xC000DE30,0xC000DE30,0xC000DE30,0xC000DE30,0xDEA0DEB0,0xDEA0DEB0,0xDEA0DEB0,0xDEA0DEB0,
+	0xC000DE30,0xC000DE30,0xC000DE30,0xC000DE30,0xDEA0DEB0,0xDEA0DEB0,0xDEA0DEB0,0xDEA0DEB0,
+	0xC000DE30,0xC000DE30,0xC000DE30,0xC000DE30,0xDEA0DEB0,0xDEA0DEB0,0xDEA0DEB0,0xDEA0DEB0,
+	0xC000DE30,0xC000DE30,0xC000DE30,0xC000DE30,0xDEA0DEB0,0xDEA0DEB0,0xDEA0DEB0,0xDEA0DEB0,
+	0xC000DE30,0xC000DE30,0xC000DE30,0xC000DE30,0xDEA0DEB0,0xDEA0DEB0,0xDEA0DEB0,0xDEA0DEB0,
+	0xC000DE30,0xC000DE30,0xC000DE30,0xC000DE30,0xDEA0DEB0,0xDEA0DEB0,0xDEA0DEB0,0xDEA0DEB0,
+	0xC000DE30,0xC000DE30,0xC000DE30,0xC000DE30,0xDEA0DEB0,0xDEA0DEB0,0xDEA0DEB0,0xDEA0DEB0,
+	0xC000DE30,0xC000DE30,0xC000DE30,0xC000DE30,0xDEA0DEB0,0xDEA0DEB0,0xDEA0DEB0,0xDEA0DEB0,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0xC000DE30,0xC000DE30,0xC000DE30,0xC000DE30,0xDEA0DEB0,0xDEA0DEB0,0xDEA0DEB0,0xDEA0DEB0,
+	0xC000DE30,0xC000DE30,0xC000DE30,0xC000DE30,0xDEA0DEB0,0xDEA0DEB0,0xDEA0DEB0,0xDEA0DEB0,
+	0xC000DE30,0xC000DE30,0xC000DE30,0xC000DE30,0xDEA0DEB0,0xDEA0DEB0,0xDEA0DEB0,0xDEA0DEB0,
+	0xC000DE30,0xC000DE30,0xC000DE30,0xC000DE30,0xDEA0DEB0,0xDEA0DEB0,0xDEA0DEB0,0xDEA0DEB0,
+	0xC000DE30,0xC000DE30,0xC000DE30,0xC000DE30,0xDEA0DEB0,0xDEA0DEB0,0xDEA0DEB0,0xDEA0DEB0,
+	0xC000DE30,0xC000DE30,0xC000DE30,0xC000DE30,0xDEA0DEB0,0xDEA0DEB0,0xDEA0DEB0,0xDEA0DEB0,
+	0xC000DE30,0xC000DE30,0xC000DE30,0xC000DE30,0xDEA0DEB0,0xDEA0DEB0,0xDEA0DEB0,0xDEA0DEB0,
+	0xC000DE30,0xC000DE30,0xC000DE30,0xC000DE30,0xDEA0DEB0,0xDEA0DEB0,0xDEA0DEB0,0xDEA0DEB0,
+	0x00000000,0x00000000,0x80008000,0x80008000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0x80008000,0x80008000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0x80008000,0x80008000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0x80008000,0x80008000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0x80008000,0x80008000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0x80008000,0x80008000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0x80008000,0x80008000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0x80008000,0x80008000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0x80008000,0x80008000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0x80008000,0x80008000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0x80008000,0x80008000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0x80008000,0x80008000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0x80008000,0x80008000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0x80008000,0x80008000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0x80008000,0x80008000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0x80008000,0x80008000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0xDE20C000,0xDE20C000,0xDE20DE20,0xDE20DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0xDE20C000,0xDE20C000,0xDE20DE20,0xDE20DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0xDE20C000,0xDE20C000,0xDE20DE20,0xDE20DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0xDE20C000,0xDE20C000,0xDE20DE20,0xDE20DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0xDE20C000,0xDE20C000,0xDE20DE20,0xDE20DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0xDE20C000,0xDE20C000,0xDE20DE20,0xDE20DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0xDE20C000,0xDE20C000,0xDE20DE20,0xDE20DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0xDE20C000,0xDE20C000,0xDE20DE20,0xDE20DE20,
+	0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,
+	0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,
+	0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,
+	0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,
+	0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,
+	0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,
+	0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,
+	0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0xDE20C000,0xDE20C000,0xDE20DE20,0xDE20DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0xDE20C000,0xDE20C000,0xDE20DE20,0xDE20DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0xDE20C000,0xDE20C000,0xDE20DE20,0xDE20DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0xDE20C000,0xDE20C000,0xDE20DE20,0xDE20DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0xDE20C000,0xDE20C000,0xDE20DE20,0xDE20DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0xDE20C000,0xDE20C000,0xDE20DE20,0xDE20DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0xDE20C000,0xDE20C000,0xDE20DE20,0xDE20DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0xDE20C000,0xDE20C000,0xDE20DE20,0xDE20DE20,
+	0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,
+	0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,
+	0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,
+	0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,
+	0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,
+	0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,
+	0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,
+	0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,
+	0x00000000,0x00000000,0x80008000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,
+	0x40004000,0x40004000,0xC000DE20,0xC000DE20,0xC080C080,0xC080C080,0xC080DEA0,0xC080DEA0,
+	0x40004000,0x40004000,0xC000DE20,0xC000DE20,0xC080C080,0xC080C080,0xC080DEA0,0xC080DEA0,
+	0x40004000,0x40004000,0xC000DE20,0xC000DE20,0xC080C080,0xC080C080,0xC080DEA0,0xC080DEA0,
+	0x40004000,0x40004000,0xC000DE20,0xC000DE20,0xC080C080,0xC080C080,0xC080DEA0,0xC080DEA0,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,
+	0x40004000,0x40004000,0xC000DE20,0xC000DE20,0xC080C080,0xC080C080,0xC080DEA0,0xC080DEA0,
+	0x40004000,0x40004000,0xC000DE20,0xC000DE20,0xC080C080,0xC080C080,0xC080DEA0,0xC080DEA0,
+	0x40004000,0x40004000,0xC000DE20,0xC000DE20,0xC080C080,0xC080C080,0xC080DEA0,0xC080DEA0,
+	0x40004000,0x40004000,0xC000DE20,0xC000DE20,0xC080C080,0xC080C080,0xC080DEA0,0xC080DEA0,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,
+	0xC000C000,0xC000C000,0xC000DE20,0xC000DE20,0xC080C080,0xC080C080,0xC080DEA0,0xC080DEA0,
+	0xC000C000,0xC000C000,0xC000DE20,0xC000DE20,0xC080C080,0xC080C080,0xC080DEA0,0xC080DEA0,
+	0xC000C000,0xC000C000,0xC000DE20,0xC000DE20,0xC080C080,0xC080C080,0xC080DEA0,0xC080DEA0,
+	0xC000C000,0xC000C000,0xC000DE20,0xC000DE20,0xC080C080,0xC080C080,0xC080DEA0,0xC080DEA0,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,
+	0xC000C000,0xC000C000,0xC000DE20,0xC000DE20,0xC080C080,0xC080C080,0xC080DEA0,0xC080DEA0,
+	0xC000C000,0xC000C000,0xC000DE20,0xC000DE20,0xC080C080,0xC080C080,0xC080DEA0,0xC080DEA0,
+	0xC000C000,0xC000C000,0xC000DE20,0xC000DE20,0xC080C080,0xC080C080,0xC080DEA0,0xC080DEA0,
+	0xC000C000,0xC000C000,0xC000DE20,0xC000DE20,0xC080C080,0xC080C080,0xC080DEA0,0xC080DEA0,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x40004000,0x40004000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x40004000,0x40004000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x40004000,0x40004000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x40004000,0x40004000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x40004000,0x40004000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x40004000,0x40004000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x40004000,0x40004000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x40004000,0x40004000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x40004000,0x40004000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x40004000,0x40004000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x40004000,0x40004000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x40004000,0x40004000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x40004000,0x40004000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x40004000,0x40004000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x40004000,0x40004000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x40004000,0x40004000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x40404040,0x40404040,0x40404040,0x40404040,0x40404040,0x40404040,0x40404040,0x40404040,
+	0x40404040,0x40404040,0x40404040,0x40404040,0x40404040,0x40404040,0x40404040,0x40404040,
+	0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,
+	0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,
+	0x40404040,0x40404040,0x40404040,0x40404040,0x40404040,0x40404040,0x40404040,0x40404040,
+	0x40404040,0x40404040,0x40404040,0x40404040,0x40404040,0x40404040,0x40404040,0x40404040,
+	0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,
+	0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,
+	0x40404040,0x40404040,0x40404040,0x40404040,0x40404040,0x40404040,0x40404040,0x40404040,
+	0x40404040,0x40404040,0x40404040,0x40404040,0x40404040,0x40404040,0x40404040,0x40404040,
+	0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,
+	0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,
+	0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,
+	0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,
+	0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,
+	0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,
+	0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,
+	0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,
+	0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,
+	0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,
+	0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,
+	0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,
+	0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0xDEA0DEA0,0xDEA0DEA0,0x00000000,0x00000000,0xDEA0DEA0,0xDEA0DEA0,
+	0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x40404040,0x40404040,0xDEE0DEE0,0xDEE0DEE0,0x40404040,0x40404040,0xDEE0DEE0,0xDEE0DEE0,
+	0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,
+	0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,
+	0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0xC040C040,0xC040C040,0xDEE0DEE0,0xDEE0DEE0,0xC040C040,0xC040C040,0xDEE0DEE0,0xDEE0DEE0,
+	0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,
+	0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,
+	0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0xC040C040,0xC040C040,0xDEE0DEE0,0xDEE0DEE0,0xC040C040,0xC040C040,0xDEE0DEE0,0xDEE0DEE0,
+	0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,
+	0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,
+	0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0xC040C040,0xC040C040,0xDEE0DEE0,0xDEE0DEE0,0xC040C040,0xC040C040,0xDEE0DEE0,0xDEE0DEE0,
+	0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,0xDEE0DEE0,
+	0xC050DE70,0xC050DE70,0xDEF0DEF0,0xDEF0DEF0,0xC050DE70,0xC050DE70,0xDEF0DEF0,0xDEF0DEF0,
+	0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,
+	0xC050DE70,0xC050DE70,0xDEF0DEF0,0xDEF0DEF0,0xC050DE70,0xC050DE70,0xDEF0DEF0,0xDEF0DEF0,
+	0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,
+	0xC050DE70,0xC050DE70,0xDEF0DEF0,0xDEF0DEF0,0xC050DE70,0xC050DE70,0xDEF0DEF0,0xDEF0DEF0,
+	0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,
+	0xC050DE70,0xC050DE70,0xDEF0DEF0,0xDEF0DEF0,0xC050DE70,0xC050DE70,0xDEF0DEF0,0xDEF0DEF0,
+	0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,
+	0xC050DE70,0xC050DE70,0xDEF0DEF0,0xDEF0DEF0,0xC050DE70,0xC050DE70,0xDEF0DEF0,0xDEF0DEF0,
+	0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,
+	0xC050DE70,0xC050DE70,0xDEF0DEF0,0xDEF0DEF0,0xC050DE70,0xC050DE70,0xDEF0DEF0,0xDEF0DEF0,
+	0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,
+	0xC050DE70,0xC050DE70,0xDEF0DEF0,0xDEF0DEF0,0xC050DE70,0xC050DE70,0xDEF0DEF0,0xDEF0DEF0,
+	0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,
+	0xC050DE70,0xC050DE70,0xDEF0DEF0,0xDEF0DEF0,0xC050DE70,0xC050DE70,0xDEF0DEF0,0xDEF0DEF0,
+	0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,0xDEF0DEF0,
+	0x00000000,0x00000000,0x80808080,0x80808080,0x00000000,0x00000000,0x80808080,0x80808080,
+	0xC000DE20,0xC000DE20,0xC080DEA0,0xC080DEA0,0xC000DE20,0xC000DE20,0xC080DEA0,0xC080DEA0,
+	0x40004000,0x40004000,0xC080C080,0xC080C080,0x40004000,0x40004000,0xC080C080,0xC080C080,
+	0xC000DE20,0xC000DE20,0xC080DEA0,0xC080DEA0,0xC000DE20,0xC000DE20,0xC080DEA0,0xC080DEA0,
+	0x80008000,0x80008000,0x80808080,0x80808080,0x80008000,0x80008000,0x80808080,0x80808080,
+	0xC000DE20,0xC000DE20,0xC080DEA0,0xC080DEA0,0xC000DE20,0xC000DE20,0xC080DEA0,0xC080DEA0,
+	0xC000C000,0xC000C000,0xC080C080,0xC080C080,0xC000C000,0xC000C000,0xC080C080,0xC080C080,
+	0xC000DE20,0xC000DE20,0xC080DEA0,0xC080DEA0,0xC000DE20,0xC000DE20,0xC080DEA0,0xC080DEA0,
+	0x00000000,0x00000000,0x80808080,0x80808080,0x00000000,0x00000000,0x80808080,0x80808080,
+	0xC000DE20,0xC000DE20,0xC080DEA0,0xC080DEA0,0xC000DE20,0xC000DE20,0xC080DEA0,0xC080DEA0,
+	0x40004000,0x40004000,0xC080C080,0xC080C080,0x40004000,0x40004000,0xC080C080,0xC080C080,
+	0xC000DE20,0xC000DE20,0xC080DEA0,0xC080DEA0,0xC000DE20,0xC000DE20,0xC080DEA0,0xC080DEA0,
+	0x80008000,0x80008000,0x80808080,0x80808080,0x80008000,0x80008000,0x80808080,0x80808080,
+	0xC000DE20,0xC000DE20,0xC080DEA0,0xC080DEA0,0xC000DE20,0xC000DE20,0xC080DEA0,0xC080DEA0,
+	0xC000C000,0xC000C000,0xC080C080,0xC080C080,0xC000C000,0xC000C000,0xC080C080,0xC080C080,
+	0xC000DE20,0xC000DE20,0xC080DEA0,0xC080DEA0,0xC000DE20,0xC000DE20,0xC080DEA0,0xC080DEA0,
+	0x00000000,0x00000000,0x80808080,0x80808080,0x00000000,0x00000000,0x80808080,0x80808080,
+	0xC000DE20,0xC000DE20,0xC080DEA0,0xC080DEA0,0xC000DE20,0xC000DE20,0xC080DEA0,0xC080DEA0,
+	0x40004000,0x40004000,0xC080C080,0xC080C080,0x40004000,0x40004000,0xC080C080,0xC080C080,
+	0xC000DE20,0xC000DE20,0xC080DEA0,0xC080DEA0,0xC000DE20,0xC000DE20,0xC080DEA0,0xC080DEA0,
+	0x80008000,0x80008000,0x80808080,0x80808080,0x80008000,0x80008000,0x80808080,0x80808080,
+	0xC000DE20,0xC000DE20,0xC080DEA0,0xC080DEA0,0xC000DE20,0xC000DE20,0xC080DEA0,0xC080DEA0,
+	0xC000C000,0xC000C000,0xC080C080,0xC080C080,0xC000C000,0xC000C000,0xC080C080,0xC080C080,
+	0xC000DE20,0xC000DE20,0xC080DEA0,0xC080DEA0,0xC000DE20,0xC000DE20,0xC080DEA0,0xC080DEA0,
+	0x00000000,0x00000000,0x80808080,0x80808080,0x00000000,0x00000000,0x80808080,0x80808080,
+	0xC000DE20,0xC000DE20,0xC080DEA0,0xC080DEA0,0xC000DE20,0xC000DE20,0xC080DEA0,0xC080DEA0,
+	0x40004000,0x40004000,0xC080C080,0xC080C080,0x40004000,0x40004000,0xC080C080,0xC080C080,
+	0xC000DE20,0xC000DE20,0xC080DEA0,0xC080DEA0,0xC000DE20,0xC000DE20,0xC080DEA0,0xC080DEA0,
+	0x80008000,0x80008000,0x80808080,0x80808080,0x80008000,0x80008000,0x80808080,0x80808080,
+	0xC000DE20,0xC000DE20,0xC080DEA0,0xC080DEA0,0xC000DE20,0xC000DE20,0xC080DEA0,0xC080DEA0,
+	0xC000C000,0xC000C000,0xC080C080,0xC080C080,0xC000C000,0xC000C000,0xC080C080,0xC080C080,
+	0xC000DE20,0xC000DE20,0xC080DEA0,0xC080DEA0,0xC000DE20,0xC000DE20,0xC080DEA0,0xC080DEA0,
+	0x00000000,0x00000000,0xDEA0DEA0,0xDEA0DEA0,0x00000000,0x00000000,0xDEA0DEA0,0xDEA0DEA0,
+	0xDE20C000,0xDE20C000,0xDEA0DEA0,0xDEA0DEA0,0xDE20C000,0xDE20C000,0xDEA0DEA0,0xDEA0DEA0,
+	0x00000000,0x00000000,0xDEA0DEA0,0xDEA0DEA0,0x00000000,0x00000000,0xDEA0DEA0,0xDEA0DEA0,
+	0xDE20C000,0xDE20C000,0xDEA0DEA0,0xDEA0DEA0,0xDE20C000,0xDE20C000,0xDEA0DEA0,0xDEA0DEA0,
+	0x00000000,0x00000000,0xDEA0DEA0,0xDEA0DEA0,0x00000000,0x00000000,0xDEA0DEA0,0xDEA0DEA0,
+	0xDE20C000,0xDE20C000,0xDEA0DEA0,0xDEA0DEA0,0xDE20C000,0xDE20C000,0xDEA0DEA0,0xDEA0DEA0,
+	0x00000000,0x00000000,0xDEA0DEA0,0xDEA0DEA0,0x00000000,0x00000000,0xDEA0DEA0,0xDEA0DEA0,
+	0xDE20C000,0xDE20C000,0xDEA0DEA0,0xDEA0DEA0,0xDE20C000,0xDE20C000,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,
+	0xDE20C000,0xDE20C000,0xDEA0DEA0,0xDEA0DEA0,0xDE20C000,0xDE20C000,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,
+	0xDE20C000,0xDE20C000,0xDEA0DEA0,0xDEA0DEA0,0xDE20C000,0xDE20C000,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,
+	0xDE20C000,0xDE20C000,0xDEA0DEA0,0xDEA0DEA0,0xDE20C000,0xDE20C000,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,
+	0xDE20C000,0xDE20C000,0xDEA0DEA0,0xDEA0DEA0,0xDE20C000,0xDE20C000,0xDEA0DEA0,0xDEA0DEA0,
+	0xC000DE20,0xC000DE20,0xDEA0DEA0,0xDEA0DEA0,0xC000DE20,0xC000DE20,0xDEA0DEA0,0xDEA0DEA0,
+	0xDE20DE20,0xDE20DE20,0xDEA0DEA0,0xDEA0DEA0,0xDE20DE20,0xDE20DE20,0xDEA0DEA0,0xDEA0DEA0,
+	0xC000DE20,0xC000DE20,0xDEA0DEA0,0xDEA0DEA0,0xC000DE20,0xC000DE20,0xDEA0DEA0,0xDEA0DEA0,
+	0xDE20DE20,0xDE20DE20,0xDEA0DEA0,0xDEA0DEA0,0xDE20DE20,0xDE20DE20,0xDEA0DEA0,0xDEA0DEA0,
+	0xC000DE20,0xC000DE20,0xDEA0DEA0,0xDEA0DEA0,0xC000DE20,0xC000DE20,0xDEA0DEA0,0xDEA0DEA0,
+	0xDE20DE20,0xDE20DE20,0xDEA0DEA0,0xDEA0DEA0,0xDE20DE20,0xDE20DE20,0xDEA0DEA0,0xDEA0DEA0,
+	0xC000DE20,0xC000DE20,0xDEA0DEA0,0xDEA0DEA0,0xC000DE20,0xC000DE20,0xDEA0DEA0,0xDEA0DEA0,
+	0xDE20DE20,0xDE20DE20,0xDEA0DEA0,0xDEA0DEA0,0xDE20DE20,0xDE20DE20,0xDEA0DEA0,0xDEA0DEA0,
+	0xC000DE20,0xC000DE20,0xDEA0DEA0,0xDEA0DEA0,0xC000DE20,0xC000DE20,0xDEA0DEA0,0xDEA0DEA0,
+	0xDE20DE20,0xDE20DE20,0xDEA0DEA0,0xDEA0DEA0,0xDE20DE20,0xDE20DE20,0xDEA0DEA0,0xDEA0DEA0,
+	0xC000DE20,0xC000DE20,0xDEA0DEA0,0xDEA0DEA0,0xC000DE20,0xC000DE20,0xDEA0DEA0,0xDEA0DEA0,
+	0xDE20DE20,0xDE20DE20,0xDEA0DEA0,0xDEA0DEA0,0xDE20DE20,0xDE20DE20,0xDEA0DEA0,0xDEA0DEA0,
+	0xC000DE20,0xC000DE20,0xDEA0DEA0,0xDEA0DEA0,0xC000DE20,0xC000DE20,0xDEA0DEA0,0xDEA0DEA0,
+	0xDE20DE20,0xDE20DE20,0xDEA0DEA0,0xDEA0DEA0,0xDE20DE20,0xDE20DE20,0xDEA0DEA0,0xDEA0DEA0,
+	0xC000DE20,0xC000DE20,0xDEA0DEA0,0xDEA0DEA0,0xC000DE20,0xC000DE20,0xDEA0DEA0,0xDEA0DEA0,
+	0xDE20DE20,0xDE20DE20,0xDEA0DEA0,0xDEA0DEA0,0xDE20DE20,0xDE20DE20,0xDEA0DEA0,0xDEA0DEA0,
+	0x00000000,0x00000000,0x80808080,0x80808080,0x00000000,0x00000000,0x80808080,0x80808080,
+	0xC000C000,0xC000C000,0xC080C080,0xC080C080,0xC000C000,0xC000C000,0xC080C080,0xC080C080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0x00000000,0x00000000,0x80808080,0x80808080,
+	0xC000C000,0xC000C000,0xC080C080,0xC080C080,0xC000C000,0xC000C000,0xC080C080,0xC080C080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0x00000000,0x00000000,0x80808080,0x80808080,
+	0xC000C000,0xC000C000,0xC080C080,0xC080C080,0xC000C000,0xC000C000,0xC080C080,0xC080C080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0x00000000,0x00000000,0x80808080,0x80808080,
+	0xC000C000,0xC000C000,0xC080C080,0xC080C080,0xC000C000,0xC000C000,0xC080C080,0xC080C080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0x00000000,0x00000000,0x80808080,0x80808080,
+	0xC000C000,0xC000C000,0xC080C080,0xC080C080,0xC000C000,0xC000C000,0xC080C080,0xC080C080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0x00000000,0x00000000,0x80808080,0x80808080,
+	0xC000C000,0xC000C000,0xC080C080,0xC080C080,0xC000C000,0xC000C000,0xC080C080,0xC080C080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0x00000000,0x00000000,0x80808080,0x80808080,
+	0xC000C000,0xC000C000,0xC080C080,0xC080C080,0xC000C000,0xC000C000,0xC080C080,0xC080C080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0x00000000,0x00000000,0x80808080,0x80808080,
+	0xC000C000,0xC000C000,0xC080C080,0xC080C080,0xC000C000,0xC000C000,0xC080C080,0xC080C080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0x00000000,0x00000000,0x80808080,0x80808080,
+	0xC000C000,0xC000C000,0xC080C080,0xC080C080,0xC000C000,0xC000C000,0xC080C080,0xC080C080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0x00000000,0x00000000,0x80808080,0x80808080,
+	0xC000C000,0xC000C000,0xC080C080,0xC080C080,0xC000C000,0xC000C000,0xC080C080,0xC080C080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0x00000000,0x00000000,0x80808080,0x80808080,
+	0xC000C000,0xC000C000,0xC080C080,0xC080C080,0xC000C000,0xC000C000,0xC080C080,0xC080C080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0x00000000,0x00000000,0x80808080,0x80808080,
+	0xC000C000,0xC000C000,0xC080C080,0xC080C080,0xC000C000,0xC000C000,0xC080C080,0xC080C080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0x00000000,0x00000000,0x80808080,0x80808080,
+	0xC000C000,0xC000C000,0xC080C080,0xC080C080,0xC000C000,0xC000C000,0xC080C080,0xC080C080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0x00000000,0x00000000,0x80808080,0x80808080,
+	0xC000C000,0xC000C000,0xC080C080,0xC080C080,0xC000C000,0xC000C000,0xC080C080,0xC080C080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0x00000000,0x00000000,0x80808080,0x80808080,
+	0xC000C000,0xC000C000,0xC080C080,0xC080C080,0xC000C000,0xC000C000,0xC080C080,0xC080C080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0x00000000,0x00000000,0x80808080,0x80808080,
+	0xC000C000,0xC000C000,0xC080C080,0xC080C080,0xC000C000,0xC000C000,0xC080C080,0xC080C080,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,
+	0x40004000,0x40004000,0xC000DE20,0xC000DE20,0x40004000,0x40004000,0xC000DE20,0xC000DE20,
+	0xC080C080,0xC080C080,0xC080DEA0,0xC080DEA0,0xC080C080,0xC080C080,0xC080DEA0,0xC080DEA0,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,
+	0x40004000,0x40004000,0xC000DE20,0xC000DE20,0x40004000,0x40004000,0xC000DE20,0xC000DE20,
+	0xC080C080,0xC080C080,0xC080DEA0,0xC080DEA0,0xC080C080,0xC080C080,0xC080DEA0,0xC080DEA0,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,
+	0xC000C000,0xC000C000,0xC000DE20,0xC000DE20,0xC000C000,0xC000C000,0xC000DE20,0xC000DE20,
+	0xC080C080,0xC080C080,0xC080DEA0,0xC080DEA0,0xC080C080,0xC080C080,0xC080DEA0,0xC080DEA0,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,
+	0xC000C000,0xC000C000,0xC000DE20,0xC000DE20,0xC000C000,0xC000C000,0xC000DE20,0xC000DE20,
+	0xC080C080,0xC080C080,0xC080DEA0,0xC080DEA0,0xC080C080,0xC080C080,0xC080DEA0,0xC080DEA0,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,
+	0x40004000,0x40004000,0xC000DE20,0xC000DE20,0x40004000,0x40004000,0xC000DE20,0xC000DE20,
+	0xC080C080,0xC080C080,0xC080DEA0,0xC080DEA0,0xC080C080,0xC080C080,0xC080DEA0,0xC080DEA0,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,
+	0x40004000,0x40004000,0xC000DE20,0xC000DE20,0x40004000,0x40004000,0xC000DE20,0xC000DE20,
+	0xC080C080,0xC080C080,0xC080DEA0,0xC080DEA0,0xC080C080,0xC080C080,0xC080DEA0,0xC080DEA0,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,
+	0xC000C000,0xC000C000,0xC000DE20,0xC000DE20,0xC000C000,0xC000C000,0xC000DE20,0xC000DE20,
+	0xC080C080,0xC080C080,0xC080DEA0,0xC080DEA0,0xC080C080,0xC080C080,0xC080DEA0,0xC080DEA0,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,
+	0xC000C000,0xC000C000,0xC000DE20,0xC000DE20,0xC000C000,0xC000C000,0xC000DE20,0xC000DE20,
+	0xC080C080,0xC080C080,0xC080DEA0,0xC080DEA0,0xC080C080,0xC080C080,0xC080DEA0,0xC080DEA0,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x40004000,0x40004000,0xC000C000,0xC000C000,0x40004000,0x40004000,0xC000C000,0xC000C000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x40004000,0x40004000,0xC000C000,0xC000C000,0x40004000,0x40004000,0xC000C000,0xC000C000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x40004000,0x40004000,0xC000C000,0xC000C000,0x40004000,0x40004000,0xC000C000,0xC000C000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x40004000,0x40004000,0xC000C000,0xC000C000,0x40004000,0x40004000,0xC000C000,0xC000C000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x40004000,0x40004000,0xC000C000,0xC000C000,0x40004000,0x40004000,0xC000C000,0xC000C000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x40004000,0x40004000,0xC000C000,0xC000C000,0x40004000,0x40004000,0xC000C000,0xC000C000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x40004000,0x40004000,0xC000C000,0xC000C000,0x40004000,0x40004000,0xC000C000,0xC000C000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x40004000,0x40004000,0xC000C000,0xC000C000,0x40004000,0x40004000,0xC000C000,0xC000C000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0xC000DE30,0xC000DE30,0xC000DE30,0xC000DE30,0xC000DE30,0xC000DE30,0xC000DE30,0xC000DE30,
+	0xDEA0DEB0,0xDEA0DEB0,0xDEA0DEB0,0xDEA0DEB0,0xDEA0DEB0,0xDEA0DEB0,0xDEA0DEB0,0xDEA0DEB0,
+	0xC000DE30,0xC000DE30,0xC000DE30,0xC000DE30,0xC000DE30,0xC000DE30,0xC000DE30,0xC000DE30,
+	0xDEA0DEB0,0xDEA0DEB0,0xDEA0DEB0,0xDEA0DEB0,0xDEA0DEB0,0xDEA0DEB0,0xDEA0DEB0,0xDEA0DEB0,
+	0xC000DE30,0xC000DE30,0xC000DE30,0xC000DE30,0xC000DE30,0xC000DE30,0xC000DE30,0xC000DE30,
+	0xDEA0DEB0,0xDEA0DEB0,0xDEA0DEB0,0xDEA0DEB0,0xDEA0DEB0,0xDEA0DEB0,0xDEA0DEB0,0xDEA0DEB0,
+	0xC000DE30,0xC000DE30,0xC000DE30,0xC000DE30,0xC000DE30,0xC000DE30,0xC000DE30,0xC000DE30,
+	0xDEA0DEB0,0xDEA0DEB0,0xDEA0DEB0,0xDEA0DEB0,0xDEA0DEB0,0xDEA0DEB0,0xDEA0DEB0,0xDEA0DEB0,
+	0xC000DE30,0xC000DE30,0xC000DE30,0xC000DE30,0xC000DE30,0xC000DE30,0xC000DE30,0xC000DE30,
+	0xDEA0DEB0,0xDEA0DEB0,0xDEA0DEB0,0xDEA0DEB0,0xDEA0DEB0,0xDEA0DEB0,0xDEA0DEB0,0xDEA0DEB0,
+	0xC000DE30,0xC000DE30,0xC000DE30,0xC000DE30,0xC000DE30,0xC000DE30,0xC000DE30,0xC000DE30,
+	0xDEA0DEB0,0xDEA0DEB0,0xDEA0DEB0,0xDEA0DEB0,0xDEA0DEB0,0xDEA0DEB0,0xDEA0DEB0,0xDEA0DEB0,
+	0xC000DE30,0xC000DE30,0xC000DE30,0xC000DE30,0xC000DE30,0xC000DE30,0xC000DE30,0xC000DE30,
+	0xDEA0DEB0,0xDEA0DEB0,0xDEA0DEB0,0xDEA0DEB0,0xDEA0DEB0,0xDEA0DEB0,0xDEA0DEB0,0xDEA0DEB0,
+	0xC000DE30,0xC000DE30,0xC000DE30,0xC000DE30,0xC000DE30,0xC000DE30,0xC000DE30,0xC000DE30,
+	0xDEA0DEB0,0xDEA0DEB0,0xDEA0DEB0,0xDEA0DEB0,0xDEA0DEB0,0xDEA0DEB0,0xDEA0DEB0,0xDEA0DEB0,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0xDE20C000,0xDE20C000,0xDE20DE20,0xDE20DE20,0xDE20C000,0xDE20C000,0xDE20DE20,0xDE20DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0xDE20C000,0xDE20C000,0xDE20DE20,0xDE20DE20,0xDE20C000,0xDE20C000,0xDE20DE20,0xDE20DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0xDE20C000,0xDE20C000,0xDE20DE20,0xDE20DE20,0xDE20C000,0xDE20C000,0xDE20DE20,0xDE20DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0xDE20C000,0xDE20C000,0xDE20DE20,0xDE20DE20,0xDE20C000,0xDE20C000,0xDE20DE20,0xDE20DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0xDE20C000,0xDE20C000,0xDE20DE20,0xDE20DE20,0xDE20C000,0xDE20C000,0xDE20DE20,0xDE20DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0xDE20C000,0xDE20C000,0xDE20DE20,0xDE20DE20,0xDE20C000,0xDE20C000,0xDE20DE20,0xDE20DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0xDE20C000,0xDE20C000,0xDE20DE20,0xDE20DE20,0xDE20C000,0xDE20C000,0xDE20DE20,0xDE20DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0xDE20C000,0xDE20C000,0xDE20DE20,0xDE20DE20,0xDE20C000,0xDE20C000,0xDE20DE20,0xDE20DE20,
+	0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,
+	0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,
+	0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,
+	0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,
+	0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,
+	0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,
+	0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,
+	0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,0xDE20DE20,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,0x80808080,0x80808080,0xC080DEA0,0xC080DEA0,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x40404040,0x40404040,0x40404040,0x40404040,0x40404040,0x40404040,0x40404040,0x40404040,
+	0x40404040,0x40404040,0x40404040,0x40404040,0x40404040,0x40404040,0x40404040,0x40404040,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,
+	0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,
+	0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,
+	0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,
+	0x40404040,0x40404040,0x40404040,0x40404040,0x40404040,0x40404040,0x40404040,0x40404040,
+	0x40404040,0x40404040,0x40404040,0x40404040,0x40404040,0x40404040,0x40404040,0x40404040,
+	0x40404040,0x40404040,0x40404040,0x40404040,0x40404040,0x40404040,0x40404040,0x40404040,
+	0x40404040,0x40404040,0x40404040,0x40404040,0x40404040,0x40404040,0x40404040,0x40404040,
+	0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,
+	0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,
+	0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,
+	0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,
+	0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,
+	0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,
+	0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,
+	0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,
+	0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,
+	0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,
+	0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,
+	0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,0xC040C040,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,0x40004000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,0xDEA0DEA0,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,0xDE20C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,0xC000C000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0xDEA0DEA0,0xDEA0DEA0,0x00000000,0x00000000,0xDEA0DEA0,0xDEA0DEA0,
+	0x00000000,0x00000000,0xDEA0DEA0,0xDEA0DEA0,0x00000000,0x00000000,0xDEA0DEA0,0xDEA0DEA0,
+	0x00000000,0x00000000,0xDEA0DEA0,0xDEA0DEA0,0x00000000,0x00000000,0xDEA0DEA0,0xDEA0DEA0,
+	0x00000000,0x00000000,0xDEA0DEA0,0xDEA0DEA0,0x00000000,0x00000000,0xDEA0DEA0,0xDEA0DEA0,
+	0x00000000,0x00000000,0xDEA0DEA0,0xDEA0DEA0,0x00000000,0x00000000,0xDEA0DEA0,0xDEA0DEA0,
+	0x00000000,0x00000000,0xDEA0DEA0,0xDEA0DEA0,0x00000000,0x00000000,0xDEA0DEA0,0xDEA0DEA0,
+	0x00000000,0x00000000,0xDEA0DEA0,0xDEA0DEA0,0x00000000,0x00000000,0xDEA0DEA0,0xDEA0DEA0,
+	0x00000000,0x00000000,0xDEA0DEA0,0xDEA0DEA0,0x00000000,0x00000000,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,
+	0x00000000,0x00000000,0x80808080,0x80808080,0x00000000,0x00000000,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0x00000000,0x00000000,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0x00000000,0x00000000,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0x00000000,0x00000000,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0x00000000,0x00000000,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0x00000000,0x00000000,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0x00000000,0x00000000,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0x00000000,0x00000000,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0x00000000,0x00000000,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0x00000000,0x00000000,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0x00000000,0x00000000,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0x00000000,0x00000000,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0x00000000,0x00000000,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0x00000000,0x00000000,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0x00000000,0x00000000,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0x00000000,0x00000000,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0x00000000,0x00000000,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0x00000000,0x00000000,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0x00000000,0x00000000,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0x00000000,0x00000000,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0x00000000,0x00000000,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0x00000000,0x00000000,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0x00000000,0x00000000,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0x00000000,0x00000000,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0x00000000,0x00000000,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0x00000000,0x00000000,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0x00000000,0x00000000,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0x00000000,0x00000000,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0x00000000,0x00000000,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0x00000000,0x00000000,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0x00000000,0x00000000,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0x00000000,0x00000000,0x80808080,0x80808080,
+	0x00000000,0x00000000,0xDEA0DEA0,0xDEA0DEA0,0x00000000,0x00000000,0xDEA0DEA0,0xDEA0DEA0,
+	0x00000000,0x00000000,0xDEA0DEA0,0xDEA0DEA0,0x00000000,0x00000000,0xDEA0DEA0,0xDEA0DEA0,
+	0x00000000,0x00000000,0xDEA0DEA0,0xDEA0DEA0,0x00000000,0x00000000,0xDEA0DEA0,0xDEA0DEA0,
+	0x00000000,0x00000000,0xDEA0DEA0,0xDEA0DEA0,0x00000000,0x00000000,0xDEA0DEA0,0xDEA0DEA0,
+	0x00000000,0x00000000,0xDEA0DEA0,0xDEA0DEA0,0x00000000,0x00000000,0xDEA0DEA0,0xDEA0DEA0,
+	0x00000000,0x00000000,0xDEA0DEA0,0xDEA0DEA0,0x00000000,0x00000000,0xDEA0DEA0,0xDEA0DEA0,
+	0x00000000,0x00000000,0xDEA0DEA0,0xDEA0DEA0,0x00000000,0x00000000,0xDEA0DEA0,0xDEA0DEA0,
+	0x00000000,0x00000000,0xDEA0DEA0,0xDEA0DEA0,0x00000000,0x00000000,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,
+	0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,0x80008000,0x80008000,0xDEA0DEA0,0xDEA0DEA0,
+	0x00000000,0x00000000,0x80808080,0x80808080,0x00000000,0x00000000,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0x00000000,0x00000000,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0x00000000,0x00000000,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0x00000000,0x00000000,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0x00000000,0x00000000,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0x00000000,0x00000000,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0x00000000,0x00000000,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0x00000000,0x00000000,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0x00000000,0x00000000,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0x00000000,0x00000000,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0x00000000,0x00000000,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0x00000000,0x00000000,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0x00000000,0x00000000,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0x00000000,0x00000000,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0x00000000,0x00000000,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0x00000000,0x00000000,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0x00000000,0x00000000,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0x00000000,0x00000000,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0x00000000,0x00000000,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0x00000000,0x00000000,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0x00000000,0x00000000,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0x00000000,0x00000000,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0x00000000,0x00000000,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0x00000000,0x00000000,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0x00000000,0x00000000,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0x00000000,0x00000000,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0x00000000,0x00000000,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0x00000000,0x00000000,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0x00000000,0x00000000,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0x00000000,0x00000000,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0x00000000,0x00000000,0x80808080,0x80808080,
+	0x00000000,0x00000000,0x80808080,0x80808080,0x00000000,0x00000000,0x80808080,0x80808080,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x80008000,0x80008000,0xC000DE20,0xC000DE20,0x80008000,0x80008000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0xC000DE20,0xC000DE20,0x00000000,0x00000000,0xC000DE20,0xC000DE20,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x80008000,0x80008000,0x00000000,0x00000000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,0x80008000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+	0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+};
@@ -37,7 +37,7 @@ namespace {
 /// Version number. If Version is left empty, then compile date in the format
 /// DD-MM-YY and show in engine_info.
 #ifndef USE_AVX2_EVAL
-const string Version = "WCSC26 No SSE|AVX";
+const string Version = "WCSC26";
 #else
 const string Version = "WCSC26 AVX";
 #endif
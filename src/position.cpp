@@ -114,7 +114,6 @@ const Value PieceValueEndgame[32] = {
 	Value(DBishop +DHorse),
 	Value(DRook   +DDragon),
 };
-unsigned char Position::DirTbl[0xA0][0x100];	// p[from][to]
 #else
 Value PieceValue[PHASE_NB][PIECE_NB] = {
 	{ VALUE_ZERO, PawnValueMg, KnightValueMg, BishopValueMg, RookValueMg, QueenValueMg },
@@ -1398,6 +1397,10 @@ void Position::do_null_move(StateInfo& newSt) {
 	std::memcpy(&newSt, st, sizeof(StateInfo));
 	newSt.previous = st;
 	st = &newSt;
+#if defined(EVAL_APERY) && defined(TWIG)
+	// Ֆʂ͕ςȂ̂ŁA]l̓(evalSum)͂̂܂܈p
+	st->lastMove = MOVE_NULL;
+#endif
 
 	// Back up the information necessary to undo the null move to the supplied
 	// StateInfo object.
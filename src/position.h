@@ -74,6 +74,13 @@ struct StateInfo {
 	uint32_t hand;
 	uint32_t effect;
 	Key key;
+#if defined(EVAL_APERY) && defined(TWIG)
+	// ]l̍vZp(evaluate_apery.cpp Q)
+	// do_move()ŃRs[Ȃ悤Akey ɒu
+	Move lastMove;			// ̋ǖʂɎ(MOVE_NONE:JnǖʁAMOVE_NULL:pX)
+	bool evalComputed;		// evalSum vZς݂
+	int evalSum[3][2];		// EvalSum::p Ɠ(MATERIAL ͊܂܂Ȃ)
+#endif
 #else
   // Copied when making a move
   Key    pawnKey;
@@ -203,6 +210,7 @@ public:
 	bool move_attacks_square(Move m, Square s) const;
 	bool pl_move_is_legal(const Move m) const;
 	bool is_pseudo_legal(const Move m) const {return pl_move_is_legal(m);}
+	Move unpack_move(const uint16_t m16) const;				// u\16bit`w𕜌
   bool capture(Move m) const;
   bool capture_or_promotion(Move m) const;
   PieceType captured_piece_type() const;
@@ -340,6 +348,10 @@ public:
 	int Mate3(const Color us, Move &m);
 //	int EvasionRest2(const Color us, MoveStack *antichecks, unsigned int &PP, unsigned int &DP, int &dn);
 	int EvasionRest2(const Color us, MoveStack *antichecks);
+	// 5A7c̋l(Aǖʐ̏)
+	int MateN(const Color us, const int maxPly, Move &m, int &matePly, int64_t nodes);
+	int MateRestN(const Color us, const int depth, Move &m, int64_t &nodes);
+	int EvasionRestN(const Color us, const int depth, int64_t &nodes);
 
 	template<Color>
 	effect_t exist_effect(int pos) const;				// 
@@ -348,6 +360,8 @@ public:
 
 	// ǖʂHuffman
 	int EncodeHuffman(unsigned char buf[32]) const;
+	// HuffmanǖʂSFENɖ߂
+	static int DecodeHuffman(const unsigned char buf[32], std::string &sfen);
 #endif
 
   // Static exchange evaluation
@@ -540,7 +554,7 @@ private:
 #ifdef USAPYON2
 	static Key zobHand[GRY + 1][32];
 #endif
-	static unsigned char DirTbl[0xA0][0x100];	// p[from][to]
+	static const unsigned char DirTbl[0xA0][0x100];	// p[from][to]
 
 	// 萶pe[u
 	static const struct ST_OuteMove2 {
@@ -551,7 +565,7 @@ private:
 			int nari;
 		} to[6];
 	} OuteMove2[32];
-	static uint32_t TblMate1plydrop[0x10000];	// łŋlޔfe[u.
+	static const uint32_t TblMate1plydrop[0x10000];	// łŋlޔfe[u.
 
 	friend void init_application_once();	// st@CNɍs.
 	friend class SearchMateDFPN;
@@ -562,6 +576,13 @@ private:
 
 extern std::ostream& operator<<(std::ostream& os, const Position& pos);
 
+#if defined(NANOHA)
+// Mate3()MateN()̌ʂunbV(TCYMBP)
+extern void resize_mate3_hash(size_t mbSize);
+extern void resize_mate7_hash(size_t mbSize);
+extern void clear_mate3_hash();
+#endif
+
 inline Color Position::side_to_move() const {
   return sideToMove;
 }
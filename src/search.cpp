@@ -43,6 +43,7 @@
 #endif
 #ifdef NANOHA
 #include "book.h"
+#include "dfpn.h"
 #endif
 
 #ifdef NANOHA
@@ -70,11 +71,6 @@ namespace Tablebases {
 namespace TB = Tablebases;
 #endif
 
-#ifdef USAPYON2
-extern bool isIgnoreMove(Move m);
-extern bool isForceMove(Move m);
-#endif
-
 using std::string;
 #ifndef NANOHA
 using Eval::evaluate;
@@ -98,6 +94,12 @@ namespace {
     return Reductions[PvNode][i][std::min(d, 63 * ONE_PLY)][std::min(mn, 63)];
   }
 
+  // Sizes and phases of the skip blocks that spread the root depths over the
+  // helper threads: helper i searches SkipSize[i] depths, then skips as many,
+  // shifted by SkipPhase[i]. The pattern repeats every 20 helpers.
+  const int SkipSize[]  = { 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4 };
+  const int SkipPhase[] = { 0, 1, 0, 1, 2, 3, 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5, 6, 7 };
+
   // Skill struct is used to implement strength limiting
   struct Skill {
 	Skill() { best = MOVE_NONE; }
@@ -157,6 +159,9 @@ namespace {
 
   EasyMoveManager EasyMove;
   Value DrawValue[COLOR_NB];
+#ifdef NANOHA
+  int64_t Mate7Nodes;
+#endif
   CounterMovesHistoryStats CounterMovesHistory;
 
   template <NodeType NT>
@@ -170,6 +175,10 @@ namespace {
   void update_pv(Move* pv, Move move, Move* childPv);
   void update_stats(const Position& pos, Stack* ss, Move move, Depth depth, Move* quiets, int quietsCnt);
   void check_time();
+#ifdef NANOHA
+  bool same_move(Move m1, Move m2);
+  void save_mate(const Position& pos, const std::vector<Move>& pv);
+#endif
 
 } // namespace
 
@@ -209,6 +218,9 @@ void Search::clear() {
 
   TT.clear();
   CounterMovesHistory.clear();
+#ifdef NANOHA
+  clear_mate3_hash();
+#endif
 
   for (Thread* th : Threads)
   {
@@ -279,6 +291,29 @@ void MainThread::search() {
   int contempt = Options["Contempt"] * PawnValueMidgame / 100; // From centipawns
   DrawValue[ us] = VALUE_DRAW - Value(contempt);
   DrawValue[~us] = VALUE_DRAW + Value(contempt);
+#ifdef NANOHA
+  Mate7Nodes = Options["Mate7Nodes"];
+#endif
+
+#ifdef NANOHA
+  // go mate : l̉𓚂ԂďI
+  if (Limits.mate) {
+	  std::vector<Move> pv;
+	  SearchMateDFPN::Result result = MateSearch.search(rootPos, pv, uint64_t(int(Options["MateNodes"])),
+	                                                    Limits.mate == INT_MAX ? 0 : Limits.mate, &Signals.stop);
+	  sync_cout << "info nodes " << MateSearch.nodes_searched()
+	            << " time " << now() - Limits.startTime << sync_endl;
+	  if (result == SearchMateDFPN::MATE) {
+		  sync_cout << "checkmate";
+		  for (Move m : pv)
+			  std::cout << " " << UCI::move(m);
+		  std::cout << sync_endl;
+	  }
+	  else
+		  sync_cout << (result == SearchMateDFPN::NO_MATE ? "checkmate nomate" : "checkmate timeout") << sync_endl;
+	  return;
+  }
+#endif
 
 #ifndef NANOHA
   TB::Hits = 0;
@@ -299,22 +334,41 @@ void MainThread::search() {
 #ifdef NANOHA
   bool SentBestmove = false;
   // ʏ錾ł邩H
-  if (rootPos.IsKachi(us) != false) {
+  // jobł̓[gǖʂ̈ꕔ̎T̂ŁA錾ՁAl݂̊mF͂Ȃ
+  const bool job = !Limits.job.empty();
+  if (!job && rootPos.IsKachi(us) != false) {
 	  SentBestmove = true;
 	  sync_cout << "bestmove win";
   }
-  else if (Options["OwnBook"]) {
+  else if (!job && Options["OwnBook"]) {
 	bool bBestBookMove = !Options["RandomBookSelect"];
 #ifdef USAPYON2
 	Move bookMove = book[us] ? book[us]->get_move(rootPos, bBestBookMove) : MOVE_NONE;
 #else
 	Move bookMove = book ? book->get_move(rootPos, bBestBookMove) : MOVE_NONE;
 #endif
-	if (bookMove != MOVE_NONE){
+	if (bookMove != MOVE_NONE
+	 && std::count_if(rootMoves.begin(), rootMoves.end(),
+	                  [&](const RootMove& rm) { return same_move(rm.pv[0], bookMove); })) {
 		SentBestmove = true;
 		sync_cout << "bestmove " << move_to_uci(bookMove);
 	}
   }
+  // 7ȓ̋l݂ΒTɎw
+  // (ponder/infinitełstop/ponderhit܂bestmoveԂȂ̂ŒTɔC)
+  if (!job && !SentBestmove && !rootMoves.empty() && Mate7Nodes > 0
+   && !Limits.ponder && !Limits.infinite) {
+	Move mateMove;
+	int matePly;
+	if (rootPos.MateN(us, 7, mateMove, matePly, Mate7Nodes) == VALUE_MATE
+	 && std::count_if(rootMoves.begin(), rootMoves.end(),
+	                  [&](const RootMove& rm) { return same_move(rm.pv[0], mateMove); })) {
+		SentBestmove = true;
+		sync_cout << "info depth " << matePly << " score " << UCI::value(mate_in(matePly))
+		          << " pv " << UCI::move(mateMove) << sync_endl;
+		sync_cout << "bestmove " << UCI::move(mateMove);
+	}
+  }
 #endif
 #ifdef USAPYON2
   // ׂɂǂillegal moveė錻ۂ̑΍
@@ -322,6 +376,8 @@ void MainThread::search() {
   if (!SentBestmove) {
 	  if (rootMoves.empty()) {
 		  sync_cout << "info depth 0 score " << UCI::value(-VALUE_MATE) << sync_endl;
+		  if (job)
+			  sync_cout << "jobdone " << Limits.job << " bestmove resign" << sync_endl;
 		  sync_cout << "bestmove resign";
 		  SentBestmove = true;
 	  }
@@ -379,6 +435,8 @@ void MainThread::search() {
       }
 #endif
 
+      // Set up all the helpers first and only then wake them up in a tight
+      // loop, so that they all begin searching at nearly the same time.
       for (Thread* th : Threads)
       {
           th->maxPly = 0;
@@ -387,10 +445,26 @@ void MainThread::search() {
           {
               th->rootPos = Position(rootPos, th);
               th->rootMoves = rootMoves;
-              th->start_searching();
           }
       }
 
+#ifdef NANOHA
+      // lݒTXbh̓[gǖʑŜ̂ŁA[g̎̈ꕔTjobł͎gȂ
+      if (Threads.mateThread && !job)
+          Threads.mateThread->rootPos = Position(rootPos, Threads.mateThread);
+#endif
+
+      for (Thread* th : Threads)
+          if (th != this)
+              th->start_searching();
+
+#ifdef NANOHA
+      if (Threads.mateThread && !job)
+          Threads.mateThread->start_searching();
+#endif
+
+      Threads.timer->start();
+
       Thread::search(); // Let's start searching!
   }
 #ifdef NANOHA
@@ -414,12 +488,18 @@ void MainThread::search() {
 
   // Stop the threads if not already stopped
   Signals.stop = true;
+  Threads.timer->stop();
 
   // Wait until all threads have finished
   for (Thread* th : Threads)
       if (th != this)
           th->wait_for_search_finished();
 
+#ifdef NANOHA
+  if (Threads.mateThread)
+      Threads.mateThread->wait_for_search_finished();
+#endif
+
   // Check if there are threads with a better score than main thread
   Thread* bestThread = this;
   if (   !this->easyMovePlayed
@@ -433,12 +513,42 @@ void MainThread::search() {
   }
 
 #ifdef NANOHA
+  // lTXbhǖʂ̋l݂ؖĂ΁A̎菇D悷
+  if (   !SentBestmove
+      && Threads.mateThread
+      && Threads.mateThread->rootMateFound)
+  {
+      const std::vector<Move>& matePv = Threads.mateThread->rootMatePv;
+      auto it = std::find_if(rootMoves.begin(), rootMoves.end(),
+                             [&](const RootMove& rm) { return same_move(rm.pv[0], matePv[0]); });
+      if (it != rootMoves.end())
+      {
+          std::rotate(rootMoves.begin(), it, it + 1);
+          rootMoves[0].score = mate_in(int(matePv.size()));
+          rootMoves[0].pv = matePv;
+          bestThread = this;
+          sync_cout << UCI::pv(rootPos, completedDepth, -VALUE_INFINITE, VALUE_INFINITE) << sync_endl;
+      }
+  }
+
   if (!SentBestmove) {
 #endif
 	// Send new PV when needed
 	if (bestThread != this)
-		sync_cout << UCI::pv(bestThread->rootPos, bestThread->completedDepth, -VALUE_INFINITE, VALUE_INFINITE) << sync_endl;
+		sync_cout << UCI::pv(bestThread->rootPos, bestThread->completedDepth, Limits.alpha, Limits.beta) << sync_endl;
 #ifdef NANOHA
+	// job̌ʂAjobidtbestmovȇOɑ
+	if (job)
+	{
+		const RootMove& rm = bestThread->rootMoves[0];
+		sync_cout << "jobdone " << Limits.job
+		          << " bestmove " << UCI::move(rm.pv[0])
+		          << " score " << UCI::value(rm.score)
+		          << (rm.score >= Limits.beta ? " lowerbound" : rm.score <= Limits.alpha ? " upperbound" : "")
+		          << " depth " << bestThread->completedDepth / ONE_PLY
+		          << " nodes " << Threads.nodes_searched()
+		          << " time " << Time.elapsed() << sync_endl;
+	}
 	sync_cout << "bestmove " << UCI::move(bestThread->rootMoves[0].pv[0]);
 #else
 	sync_cout << "bestmove " << UCI::move(bestThread->rootMoves[0].pv[0], rootPos.is_chess960());
@@ -471,8 +581,9 @@ void Thread::search() {
 
   std::memset(ss-2, 0, 5 * sizeof(Stack));
 
-  bestValue = delta = alpha = -VALUE_INFINITE;
-  beta = VALUE_INFINITE;
+  bestValue = delta = -VALUE_INFINITE;
+  alpha = Limits.alpha;
+  beta = Limits.beta;
   completedDepth = DEPTH_ZERO;
 
   if (mainThread)
@@ -494,33 +605,39 @@ void Thread::search() {
 
   multiPV = std::min(multiPV, rootMoves.size());
 
+  // Helper threads schedule, see SMP_* options
+  const bool depthSkip = Options["SMP_Depth_Skip"];
+  const int maxPerDepth = Options["SMP_Max_Per_Depth"];
+
+  // Each helper starts from a different root move, so that its first
+  // iterations, and the TT entries they leave, differ from the main thread's.
+  if (!mainThread && Options["SMP_Root_Offset"] && rootMoves.size() > 1)
+      std::rotate(rootMoves.begin(), rootMoves.begin() + idx % rootMoves.size(), rootMoves.end());
+
   // Iterative deepening loop until requested to stop or target depth reached
   while (++rootDepth < DEPTH_MAX && !Signals.stop && (!Limits.depth || rootDepth <= Limits.depth))
   {
-      // Set up the new depth for the helper threads skipping in average each
-      // 2nd ply (using a half density map similar to a Hadamard matrix).
       if (!mainThread)
       {
-          int d = rootDepth + rootPos.game_ply();
-
-          if (idx <= 6 || idx > 24)
+          // Set up the new depth for the helper threads, skipping in average
+          // each 2nd ply in blocks of a per-thread size and phase.
+          if (depthSkip)
           {
-              if (((d + idx) >> (msb(idx + 1) - 1)) % 2)
-                  continue;
-          }
-          else
-          {
-              // Table of values of 6 bits with 3 of them set
-              static const int HalfDensityMap[] = {
-                0x07, 0x0b, 0x0d, 0x0e, 0x13, 0x16, 0x19, 0x1a, 0x1c,
-                0x23, 0x25, 0x26, 0x29, 0x2c, 0x31, 0x32, 0x34, 0x38
-              };
+              int i = (idx - 1) % 20;
+              int d = rootDepth / ONE_PLY + rootPos.game_ply();
 
-              if ((HalfDensityMap[idx - 7] >> (d % 6)) & 1)
+              if (((d + SkipPhase[i]) / SkipSize[i]) % 2)
                   continue;
           }
+
+          // Do not start a depth that enough threads are already searching.
+          // As the threads count themselves, the limit is only approximate.
+          if (maxPerDepth && Threads.depthSearchers[rootDepth] >= maxPerDepth)
+              continue;
       }
 
+      ++Threads.depthSearchers[rootDepth];
+
       // Age out PV variability metric
       if (mainThread)
           mainThread->bestMoveChanges *= 0.505, mainThread->failedLow = false;
@@ -537,8 +654,12 @@ void Thread::search() {
           if (rootDepth >= 5 * ONE_PLY)
           {
               delta = Value(18);
-              alpha = std::max(rootMoves[PVIdx].previousScore - delta,-VALUE_INFINITE);
-              beta  = std::min(rootMoves[PVIdx].previousScore + delta, VALUE_INFINITE);
+              alpha = std::max(rootMoves[PVIdx].previousScore - delta, Limits.alpha);
+              beta  = std::min(rootMoves[PVIdx].previousScore + delta, Limits.beta);
+
+              // The previous score may be well outside the window of a job
+              if (alpha >= beta)
+                  alpha = Limits.alpha, beta = Limits.beta;
           }
 
           // Start with a small aspiration window and, in the case of a fail
@@ -561,6 +682,8 @@ void Thread::search() {
               for (size_t i = 0; i <= PVIdx; ++i)
                   rootMoves[i].insert_pv_in_tt(rootPos);
 
+              nodes = rootPos.nodes_searched();
+
               // If search has been stopped break immediately. Sorting and
               // writing PV back to TT is safe because RootMoves is still
               // valid, although it refers to previous iteration.
@@ -575,12 +698,18 @@ void Thread::search() {
                   && Time.elapsed() > 3000)
                   sync_cout << UCI::pv(rootPos, rootDepth, alpha, beta) << sync_endl;
 
+              // Failing low/high of the window given by a job only gives a
+              // bound, as the master asked for.
+              if (   (bestValue <= alpha && alpha <= Limits.alpha)
+                  || (bestValue >= beta && beta >= Limits.beta))
+                  break;
+
               // In case of failing low/high increase aspiration window and
               // re-search, otherwise exit the loop.
               if (bestValue <= alpha)
               {
                   beta = (alpha + beta) / 2;
-                  alpha = std::max(bestValue - delta, -VALUE_INFINITE);
+                  alpha = std::max(bestValue - delta, Limits.alpha);
 
                   if (mainThread)
                   {
@@ -591,7 +720,7 @@ void Thread::search() {
               else if (bestValue >= beta)
               {
                   alpha = (alpha + beta) / 2;
-                  beta = std::min(bestValue + delta, VALUE_INFINITE);
+                  beta = std::min(bestValue + delta, Limits.beta);
               }
               else
                   break;
@@ -608,13 +737,16 @@ void Thread::search() {
               break;
 
           if (Signals.stop)
-              sync_cout << "info nodes " << Threads.nodes_searched()
+              sync_cout << "info" << (Limits.job.empty() ? "" : " job " + Limits.job)
+                        << " nodes " << Threads.nodes_searched()
                         << " time " << Time.elapsed() << sync_endl;
 
           else if (PVIdx + 1 == multiPV || Time.elapsed() > 3000)
               sync_cout << UCI::pv(rootPos, rootDepth, alpha, beta) << sync_endl;
       }
 
+      --Threads.depthSearchers[rootDepth];
+
       if (!Signals.stop)
           completedDepth = rootDepth;
 
@@ -665,6 +797,8 @@ void Thread::search() {
       }
   }
 
+  nodes = rootPos.nodes_searched();
+
   if (!mainThread)
       return;
 
@@ -679,6 +813,149 @@ void Thread::search() {
                 rootMoves.end(), skill.best_move(multiPV)));
 }
 
+/// TimerThread::search() checks the time and node limits every Resolution
+/// milliseconds, raising Signals.stop when they are reached, until stopped.
+
+void TimerThread::search() {
+
+  std::unique_lock<Mutex> lk(timerMutex);
+
+  while (run)
+  {
+      timerCondition.wait_for(lk, std::chrono::milliseconds(Resolution));
+
+      if (run)
+          check_time();
+  }
+}
+
+
+#ifdef NANOHA
+/// MateThread::search() runs the df-pn mate solver in the background while the
+/// other threads search. It tries the root position and then the positions
+/// along the PV stored in TT, doubling the node budget on each sweep. Proven
+/// mates are saved in TT; a mate at the root also stops the search.
+
+void MateThread::search() {
+
+  const int MaxPvPly = 8;
+  StateInfo st[MaxPvPly];
+  Move moves[MaxPvPly];
+  std::vector<Move> pv;
+  uint64_t budget = 4096;
+
+  while (!Signals.stop)
+  {
+      int ply = 0;
+
+      while (!Signals.stop)
+      {
+          if (MateSearch.search(rootPos, pv, budget, 0, &Signals.stop) == SearchMateDFPN::MATE)
+          {
+              save_mate(rootPos, pv);
+
+              if (ply == 0)
+              {
+                  rootMatePv = pv;
+                  rootMateFound = true;
+
+                  // l݂m肵̂ŒTł؂(ponderponderhit҂)
+                  if (Limits.ponder)
+                      Signals.stopOnPonderhit = true;
+                  else if (!Limits.infinite)
+                  {
+                      Signals.stop = true;
+                      Threads.main()->start_searching(true); // Could be sleeping
+                  }
+                  break;
+              }
+          }
+
+          if (ply == MaxPvPly)
+              break;
+
+          // TTɎcĂőPǂĎ̋ǖʂ֐i
+          // (TT̓bNȂŋLAL[̏ƍ16bitȂ̂ŁA̗pӏƓ@肩m߂)
+          bool ttHit;
+          const TTEntry* tte = TT.probe(rootPos.key(), ttHit);
+          Move m = ttHit ? rootPos.unpack_move(tte->move()) : MOVE_NONE;
+          if (m == MOVE_NONE || !rootPos.pl_move_is_legal(m))
+              break;
+
+          moves[ply] = m;
+          rootPos.do_move(m, st[ply++], 0);
+      }
+
+      while (ply > 0)
+          rootPos.undo_move(moves[--ply]);
+
+      if (rootMateFound)
+          break;
+
+      if (budget < (uint64_t(1) << 32))
+          budget *= 2;
+  }
+}
+
+
+/// Search::think_init() prepares the globals read by think_position(): no time
+/// management, no contempt and a new TT generation. Call it once before a batch.
+
+void Search::think_init(Depth depth) {
+
+  Limits = LimitsType();
+  Limits.depth = depth / ONE_PLY;
+  Limits.startTime = now();
+  Signals.stopOnPonderhit = Signals.stop = false;
+  DrawValue[BLACK] = DrawValue[WHITE] = VALUE_DRAW;
+  Mate7Nodes = Options["Mate7Nodes"];
+  TT.new_search();
+}
+
+
+/// Search::think_position() searches pos on th, which must not be a pool thread,
+/// and returns the score for the side to move. Several threads can run it at the
+/// same time on different positions (the book tools do so). Iterative deepening
+/// stops at depth, or once nodes (if non-zero) have been searched; the node limit
+/// is only checked between iterations. th.completedDepth holds the depth reached.
+
+Value Search::think_position(Thread& th, const Position& pos, Depth depth, int64_t nodes, Move& bestMove) {
+
+  Stack stack[MAX_PLY+4], *ss = stack+2;
+  std::memset(ss-2, 0, 5 * sizeof(Stack));
+
+  th.rootPos = Position(pos, &th);
+  th.rootPos.set_nodes_searched(0);
+  th.rootMoves.clear();
+  for (MoveList<MV_LEGAL> ml(th.rootPos); !ml.end(); ++ml)
+      th.rootMoves.push_back(RootMove(ml.move()));
+
+  bestMove = MOVE_NONE;
+  if (th.rootMoves.empty())
+      return mated_in(0);
+
+  // [. Ԃ̊Ǘ͂ depth  nodes ܂ŒT
+  th.maxPly = 0;
+  th.PVIdx = 0;
+  th.completedDepth = DEPTH_ZERO;
+  for (th.rootDepth = ONE_PLY; th.rootDepth <= depth && !Signals.stop; th.rootDepth += ONE_PLY)
+  {
+      if (nodes && int64_t(th.rootPos.nodes_searched()) >= nodes)
+          break;
+
+      for (RootMove& rm : th.rootMoves)
+          rm.previousScore = rm.score;
+
+      ::search<Root>(th.rootPos, ss, -VALUE_INFINITE, VALUE_INFINITE, th.rootDepth, false);
+      std::stable_sort(th.rootMoves.begin(), th.rootMoves.end());
+      th.completedDepth = th.rootDepth;
+  }
+
+  bestMove = th.rootMoves[0].pv[0];
+  return th.rootMoves[0].score;
+}
+#endif
+
 
 namespace {
 
@@ -722,18 +999,12 @@ namespace {
     ss->ply = (ss-1)->ply + 1;
 	ss->checkmateTested = false;
 
-    // Check for available remaining time
-    if (thisThread->resetCalls.load(std::memory_order_relaxed))
+    // Publish the node count now and then for ThreadPool::nodes_searched(). The
+    // time and node limits are checked by Threads.timer.
+    if (++thisThread->callsCnt >= 1024)
     {
-        thisThread->resetCalls = false;
         thisThread->callsCnt = 0;
-    }
-    if (++thisThread->callsCnt > 4096)
-    {
-        for (Thread* th : Threads)
-            th->resetCalls = true;
-
-        check_time();
+        thisThread->nodes.store(pos.nodes_searched(), std::memory_order_relaxed);
     }
 
     // Used to send selDepth info to GUI
@@ -774,6 +1045,13 @@ namespace {
 			if (val == VALUE_MATE) {
 				return mate_in(ss->ply + 2);
 			}
+			// PVm[hł7l߂܂Œׂ
+			if (PvNode && Mate7Nodes > 0) {
+				int matePly;
+				if (pos.MateN(pos.side_to_move(), 7, m, matePly, Mate7Nodes) == VALUE_MATE) {
+					return mate_in(ss->ply + matePly - 1);
+				}
+			}
 		}
 #endif
 
@@ -803,7 +1081,7 @@ namespace {
     tte = TT.probe(posKey, ttHit);
     ttValue = ttHit ? value_from_tt(tte->value(), ss->ply) : VALUE_NONE;
     ttMove =  RootNode ? thisThread->rootMoves[thisThread->PVIdx].pv[0]
-            : ttHit    ? tte->move() : MOVE_NONE;
+            : ttHit    ? pos.unpack_move(tte->move()) : MOVE_NONE;
 
     // At non-PV nodes we check for an early TT cutoff
     if (  !PvNode
@@ -977,16 +1255,6 @@ namespace {
 
 		while ((move = mp.next_move()) != MOVE_NONE) {
 #ifdef USAPYON2
-			if (ss->ply == 1) {
-				// [gȂ̂ignoreMoves`FbN
-				if (isIgnoreMove(move)) {
-					continue;
-				}
-				// [gȂ̂forceMove`FbN
-				if (!isForceMove(move)) {
-					continue;
-				}
-			}
 			if ((move & MOVE_CHECK_NARAZU) != 0) {
 				// 킴킴ꂽ炸̎r
 				continue;
@@ -1016,7 +1284,7 @@ namespace {
         ss->skipEarlyPruning = false;
 
         tte = TT.probe(posKey, ttHit);
-        ttMove = ttHit ? tte->move() : MOVE_NONE;
+        ttMove = ttHit ? pos.unpack_move(tte->move()) : MOVE_NONE;
     }
 
 moves_loop: // When in check search starts from here
@@ -1057,16 +1325,6 @@ moves_loop: // When in check search starts from here
     {
       assert(is_ok(move));
 #ifdef USAPYON2
-	  if (ss->ply==1) {
-		  // [gȂ̂ignoreMoves`FbN
-		  if (isIgnoreMove(move)) {
-			  // sync_cout << "info string ignore_move depth=" << ss->ply << "csa=" << move_to_csa(move) << sync_endl;
-			  continue;
-		  }
-		  if (!isForceMove(move)) {
-			  continue;
-		  }
-	  }
 	  if ((move & MOVE_CHECK_NARAZU) != 0) {
 		  // 킴킴ꂽ炸̎r
 		  continue;
@@ -1534,7 +1792,7 @@ moves_loop: // When in check search starts from here
     // Transposition table lookup
     posKey = pos.key();
     tte = TT.probe(posKey, ttHit);
-    ttMove = ttHit ? tte->move() : MOVE_NONE;
+    ttMove = ttHit ? pos.unpack_move(tte->move()) : MOVE_NONE;
     ttValue = ttHit ? value_from_tt(tte->value(), ss->ply) : VALUE_NONE;
 
     if (  !PvNode
@@ -1734,6 +1992,33 @@ moves_loop: // When in check search starts from here
           : v <= VALUE_MATED_IN_MAX_PLY ? v + ply : v;
   }
 
+#ifdef NANOHA
+  // same_move() Ȃǂ̃tO𖳎Ďw肪ׂ
+
+  bool same_move(Move m1, Move m2) {
+
+    return   move_from(m1) == move_from(m2) && move_to(m1) == move_to(m2)
+          && move_piece(m1) == move_piece(m2) && is_promotion(m1) == is_promotion(m2);
+  }
+
+
+  // save_mate() l[`ŏؖl݂TTɏށB
+  // value_to_tt() ƓAl͂̋ǖʂl݂܂ł̎萔ŎB
+
+  void save_mate(const Position& pos, const std::vector<Move>& pv) {
+
+    Value v = mate_in(int(pv.size()));
+
+    // T ply 𑫂Ă VALUE_MATE_IN_MAX_PLY Ȃ̂
+    if (v < VALUE_MATE_IN_MAX_PLY + MAX_PLY)
+        return;
+
+    bool ttHit;
+    TTEntry* tte = TT.probe(pos.key(), ttHit);
+    tte->save(pos.key(), v, BOUND_EXACT, DEPTH_MAX - ONE_PLY, pv[0], VALUE_NONE, TT.generation());
+  }
+#endif
+
 
   // update_pv() adds current move and appends child pv[]
 
@@ -1905,8 +2190,12 @@ string UCI::pv(const Position& pos, Depth depth, Value alpha, Value beta) {
       if (ss.rdbuf()->in_avail()) // Not at first line
           ss << "\n";
 
-      ss << "info"
-         << " depth "    << d / ONE_PLY
+      ss << "info";
+
+      if (!Limits.job.empty())
+          ss << " job " << Limits.job;
+
+      ss << " depth "    << d / ONE_PLY
          << " seldepth " << pos.this_thread()->maxPly
          << " multipv "  << i + 1
          << " score "    << UCI::value(v);
@@ -1961,7 +2250,7 @@ void RootMove::insert_pv_in_tt(Position& pos) {
 
       TTEntry* tte = TT.probe(pos.key(), ttHit);
 
-      if (!ttHit || tte->move() != m) // Don't overwrite correct entries
+      if (!ttHit || tte->move() != pack_move(m)) // Don't overwrite correct entries
           tte->save(pos.key(), VALUE_NONE, BOUND_NONE, DEPTH_NONE,
                     m, VALUE_NONE, TT.generation());
 #ifndef NANOHA
@@ -1999,7 +2288,7 @@ bool RootMove::extract_ponder_from_tt(Position& pos)
 
     if (ttHit)
     {
-        Move m = tte->move(); // Local copy to be SMP safe
+        Move m = pos.unpack_move(tte->move()); // Local copy to be SMP safe
         if (MoveList<MV_LEGAL>(pos).contains(m)) {
 			pos.undo_move(pv[0]);
 			return pv.push_back(m), true;
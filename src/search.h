@@ -93,16 +93,20 @@ struct LimitsType {
   LimitsType() { // Init explicitly due to broken value-initialization of non POD in MSVC
     nodes = time[WHITE] = time[BLACK] = inc[WHITE] = inc[BLACK] = npmsec = movestogo =
     depth = movetime = mate = infinite = ponder = 0;
+    alpha = -VALUE_INFINITE;
+    beta = VALUE_INFINITE;
   }
 
   bool use_time_management() const {
     return !(mate | movetime | depth | nodes | infinite);
   }
 
-  std::vector<Move> searchmoves;
+  std::vector<Move> searchmoves, ignoremoves;
   int time[COLOR_NB], inc[COLOR_NB], npmsec, movestogo, depth, movetime, mate, infinite, ponder;
   int64_t nodes;
   TimePoint startTime;
+  Value alpha, beta; // Root search window, narrower than the full one only for a job
+  std::string job;   // Id of the 'job' command being searched, empty for 'go'
 };
 
 /// The SignalsType struct stores atomic flags updated during the search
@@ -120,6 +124,10 @@ extern StateStackPtr SetupStates;
 
 void init();
 void clear();
+#ifdef NANOHA
+void think_init(Depth depth);
+Value think_position(Thread& th, const Position& pos, Depth depth, int64_t nodes, Move& bestMove);
+#endif
 #ifdef c11_implemented
 template<bool Root = true> uint64_t perft(Position& pos, Depth depth);
 #else
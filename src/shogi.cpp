@@ -257,23 +257,6 @@ void init_application_once()
 		book->open(Options["BookFile"]);
 	}
 #endif
-	int from;
-	int to;
-	int i;
-	memset(Position::DirTbl, 0, sizeof(Position::DirTbl));
-	for (from = 0x11; from <= 0x99; from++) {
-		if ((from & 0x0F) == 0 || (from & 0x0F) > 9) continue;
-		for (i = 0; i < 8; i++) {
-			int dir = NanohaTbl::Direction[i];
-			to = from;
-			while (1) {
-				to += dir;
-				if ((to & 0x0F) == 0 || (to & 0x0F) >    9) break;
-				if ((to & 0xF0) == 0 || (to & 0xF0) > 0x90) break;
-				Position::DirTbl[from][to] = (1 << i);
-			}
-		}
-	}
 }
 
 // ֌W
@@ -836,6 +819,11 @@ void Position::do_move(Move m, StateInfo& newSt,int count)
 
 	newSt.previous = st;
 	st = &newSt;
+#if defined(EVAL_APERY) && defined(TWIG)
+	// ]l evaluate() őŐǖʂ̍ŋ߂
+	st->lastMove = m;
+	st->evalComputed = false;
+#endif
 
 	// Update side to move
 	key ^= zobSideToMove;
@@ -2021,6 +2009,88 @@ bool Position::pl_move_is_legal(const Move m) const
 #endif
 }
 
+// u\16bit`(pack_move)A̋ǖʂł̎w𕜌
+// Ǝ͔Ֆʂ₤BMOVE_CHECK_NARAZU ̎͒TŏOĒu\ɓȂ̂ŕtȂ
+// pl_move_is_legal()͋ߐڋ̓␬̉ۂȂ߁Aŋ̗Ɛ邩mF
+// 16bit̃L[ł͕ʂ̋ǖʂ̎Ƃ̂ŁAOȂŏ
+// (sEEEłl߂Ȃǂ pl_move_is_legal() Œׂ)
+Move Position::unpack_move(const uint16_t m16) const
+{
+	const int sqTo = m16 & 0x7F;
+	const int sqFrom = (m16 >> 7) & 0x7F;
+	const bool promote = (m16 & (1 << 14)) != 0;
+	if (m16 == 0 || sqTo >= 81) return MOVE_NONE;
+
+	const Color us = side_to_move();
+	// conv_z2sq() ̋tϊ
+	const int to = (sqTo / 9 + 1) * 0x10 + (sqTo % 9 + 1);
+
+	// 肪ĂƂAʈȊOŎŵ͉肵Ă邩肾
+	const int ksq = (us == BLACK) ? kingS : kingG;
+	const effect_t checks = ksq ? (effect[flip(us)][ksq] & (EFFECT_SHORT_MASK | EFFECT_LONG_MASK)) : 0;
+	bool evasion = (checks == 0);
+	if (checks && (checks & (checks - 1)) == 0) {
+		unsigned long id;
+		_BitScanForward(&id, checks);
+		if (checks & EFFECT_SHORT_MASK) {
+			evasion = (to == ksq - NanohaTbl::Direction[id]);
+		} else {
+			const int dir = NanohaTbl::Direction[id - EFFECT_LONG_SHIFT];
+			for (int z = ksq - dir; !evasion; z -= dir) {
+				evasion = (z == to);
+				if (ban[z] != EMP) break;
+			}
+		}
+	}
+
+	if (sqFrom >= 81) {
+		// ł
+		const int kind = sqFrom - 81;
+		if (kind < FU || kind > HI || promote || !evasion) return MOVE_NONE;
+		return Move(To2Move(to) | Piece2Move(((us == BLACK) ? SENTE : GOTE) | kind));
+	}
+
+	const int from = (sqFrom / 9 + 1) * 0x10 + (sqFrom % 9 + 1);
+	const Piece piece = ban[from];
+	if (piece == EMP || piece == WALL || color_of(piece) != us) return MOVE_NONE;
+	const PieceType pt = type_of(piece);
+	if (!evasion && pt != OU) return MOVE_NONE;
+
+	// ړ̗̋ړɓ͂Ă邩H
+	const int d = Max(abs((from >> 4)-(to >> 4)), abs((from & 0x0F)-(to & 0x0F)));
+	const effect_t dirBit = DirTbl[from][to];
+	effect_t need;
+	switch (to - from) {
+	case DIR_KEUR: need = EFFECT_KEUR; break;
+	case DIR_KEUL: need = EFFECT_KEUL; break;
+	case DIR_KEDR: need = EFFECT_KEDR; break;
+	case DIR_KEDL: need = EFFECT_KEDL; break;
+	default:
+		// ї́Aړ悩猩čŏ̋ړ̂Ƃړ̋̂
+		if (d > 1 && SkipOverEMP(to, (from - to) / d) != from) return MOVE_NONE;
+		need = (dirBit << EFFECT_LONG_SHIFT) | ((d == 1) ? dirBit : 0);
+		break;
+	}
+	if ((effect[us][to] & need) == 0) return MOVE_NONE;
+
+	const unsigned int tmp = From2Move(from) | To2Move(to) | Piece2Move(piece) | Cap2Move(ban[to]);
+	if (promote) {
+		// EʁE͐Ȃ
+		const bool zone = (us == BLACK) ? (can_promotion<BLACK>(from) || can_promotion<BLACK>(to))
+		                                : (can_promotion<WHITE>(from) || can_promotion<WHITE>(to));
+		if (!zone || pt == KI || (pt & PROMOTED)) return MOVE_NONE;
+		return Move(tmp | FLAG_PROMO);
+	}
+
+	// ŝȂɂȂs͎wȂ
+	if (pt == FU || pt == KY) {
+		if (!((us == BLACK) ? is_drop_pawn<BLACK>(to) : is_drop_pawn<WHITE>(to))) return MOVE_NONE;
+	} else if (pt == KE) {
+		if (!((us == BLACK) ? is_drop_knight<BLACK>(to) : is_drop_knight<WHITE>(to))) return MOVE_NONE;
+	}
+	return Move(tmp);
+}
+
 // wꏊ(to)łl߂ɂȂ邩mF
 bool Position::is_pawn_drop_mate(const Color us, int to) const
 {
@@ -3515,6 +3585,39 @@ int set_bit(const int start_bit, const int bits, const int data, unsigned char b
 	}
 	return start_bit + bits;
 }
+
+// @\Ff[^1rbgo
+//
+// ߂l
+//   }CiXFG[(obt@̊O)
+//   0 or 1Forbg
+//
+int get_bit(const int start_bit, const unsigned char buf[], const int size)
+{
+	if (start_bit < 0 || start_bit >= 8*size) return -1;
+	return (buf[start_bit / 8] >> (start_bit % 8)) & 1;
+}
+
+// @\F\ tbl[0..n) ̂ǂꂩɈv܂Ńrbgǂ
+//
+// ߂l
+//   }CiXFG[
+//   0ȏFv
+//
+template<typename T>
+int get_code(int &start_bit, const T tbl[], const int n, const unsigned char buf[], const int size)
+{
+	int code = 0;
+	for (int bits = 1; bits <= 8; bits++) {
+		const int b = get_bit(start_bit++, buf, size);
+		if (b < 0) return -1;
+		code |= b << (bits - 1);
+		for (int piece = 0; piece < n; piece++) {
+			if (tbl[piece].bits == bits && tbl[piece].code == code) return piece;
+		}
+	}
+	return -2;
+}
 };
 
 // @\Fǖʂnt}(Ճ[`p)
@@ -3602,6 +3705,95 @@ int Position::EncodeHuffman(unsigned char buf[32]) const
 	return start_bit;
 }
 
+// @\Fnt}ǖʂ SFEN ɖ߂(EncodeHuffman() ̋t. Ճ[`p)
+//
+// 
+//   const unsigned char buf[];	// f[^
+//   std::string &sfen;			// ߂ǖ(萔 1 Ƃ)
+//
+// ߂l
+//   }CiXFG[
+//   ̒lFǂݍ񂾃rbg
+//
+int Position::DecodeHuffman(const unsigned char buf[32], std::string &sfen)
+{
+	static const char PieceChar[] = ".PLNSGBRKPLNS.BR.plnsgbrkplns.br";
+	const int size = 32;	// buf[] ̃TCY
+	const int nHB = sizeof(HB_tbl) / sizeof(HB_tbl[0]);
+	const int nHH = sizeof(HH_tbl) / sizeof(HH_tbl[0]);
+
+	int start_bit = 0;
+	int board[0xA0] = {0};
+	int hands[GRY + 1] = {0};
+
+	// ԂƋʂ̈ʒu
+	int side = get_bit(start_bit++, buf, size);
+	int king[2] = {0, 0};
+	for (int c = 0; c < 2; c++) {
+		int n = 0;
+		for (int i = 0; i < 7; i++) {
+			const int b = get_bit(start_bit++, buf, size);
+			if (b < 0) return -1;
+			n |= b << i;
+		}
+		if (n < 1 || n > 81) return -1;
+		king[c] = (((n - 1) / 9 + 1) << 4) + (n - 1) % 9 + 1;
+	}
+	if (side < 0 || king[0] == king[1]) return -1;
+	board[king[0]] = SOU;
+	board[king[1]] = GOU;
+
+	// Տ̃f[^(ʂ͕ʓr)
+	int suji, dan;
+	int onBoard = 0;
+	for (suji = 0x10; suji <= 0x90; suji += 0x10) {
+		for (dan = 1; dan <= 9; dan++) {
+			if (suji + dan == king[0] || suji + dan == king[1]) continue;
+			const int piece = get_code(start_bit, HB_tbl, nHB, buf, size);
+			if (piece < 0) return -2;
+			board[suji + dan] = piece;
+			if (piece != EMP) onBoard++;
+		}
+	}
+
+	// (ʈȊO38̂ՏɂȂ)
+	for (int i = onBoard; i < 38; i++) {
+		const int piece = get_code(start_bit, HH_tbl, nHH, buf, size);
+		if (piece < 0) return -3;
+		hands[piece]++;
+	}
+
+	std::string s;
+	for (dan = 1; dan <= 9; dan++) {
+		int emptyCnt = 0;
+		for (suji = 0x90; suji >= 0x10; suji -= 0x10) {
+			const int piece = board[suji + dan];
+			if (piece == EMP) {
+				emptyCnt++;
+				continue;
+			}
+			if (emptyCnt) s += char('0' + emptyCnt);
+			emptyCnt = 0;
+			if ((piece - 1) & PROMOTED) s += '+';
+			s += PieceChar[piece];
+		}
+		if (emptyCnt) s += char('0' + emptyCnt);
+		if (dan < 9) s += '/';
+	}
+	s += (side == BLACK) ? " b " : " w ";
+	const size_t handPos = s.size();
+	for (int piece = SFU; piece <= GRY; piece++) {
+		if (hands[piece] == 0) continue;
+		if (hands[piece] > 1) s += std::to_string(hands[piece]);
+		s += PieceChar[piece];
+	}
+	if (s.size() == handPos) s += '-';
+	s += " 1";
+
+	sfen = s;
+	return start_bit;
+}
+
 // CX^X.
 template MoveStack* Position::generate_capture<BLACK>(MoveStack* mlist) const;
 template MoveStack* Position::generate_capture<WHITE>(MoveStack* mlist) const;
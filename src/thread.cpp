@@ -24,6 +24,19 @@
 
 #include <algorithm> // For std::count
 #include <cassert>
+#include <chrono>
+
+#if defined(_WIN32)
+#  ifndef NOMINMAX
+#    define NOMINMAX // Disable macros min() and max()
+#  endif
+#  include <windows.h>
+#elif defined(__linux__)
+#  include <fstream>
+#  include <sched.h>
+#  include <sstream>
+#  include <string>
+#endif
 
 #include "movegen.h"
 #include "search.h"
@@ -34,13 +47,210 @@ using namespace Search;
 
 ThreadPool Threads; // Global object
 
+namespace {
+
+/// NumaNode is a NUMA node with the logical processors of it that the search
+/// threads may be bound to.
+
+struct NumaNode {
+#if defined(_WIN32)
+  GROUP_AFFINITY affinity;
+#elif defined(__linux__)
+  cpu_set_t affinity;
+#endif
+  size_t processors;
+};
+
+#if defined(__linux__)
+/// parse_list() expands a sysfs list like "0-7,16-23" into its numbers
+
+std::vector<int> parse_list(const std::string& s) {
+
+  std::vector<int> v;
+  std::istringstream ss(s);
+  std::string range;
+
+  while (std::getline(ss, range, ','))
+  {
+      int first, last;
+      char dash;
+      std::istringstream rs(range);
+
+      if (!(rs >> first))
+          continue;
+
+      if (!(rs >> dash >> last))
+          last = first;
+
+      for (int i = first; i <= last; ++i)
+          v.push_back(i);
+  }
+  return v;
+}
+#endif
+
+
+/// read_numa_nodes() returns the NUMA nodes of the machine that have logical
+/// processors the process is allowed to use. Binding is only supported on
+/// Windows and Linux, and is not worth it with a single node, so in all these
+/// cases the list is empty.
+
+std::vector<NumaNode> read_numa_nodes() {
+
+  std::vector<NumaNode> nodes;
+
+#if defined(_WIN32)
+  ULONG highest;
+  if (!GetNumaHighestNodeNumber(&highest))
+      return nodes;
+
+  for (USHORT n = 0; n <= highest; ++n)
+  {
+      NumaNode node;
+      if (GetNumaNodeProcessorMaskEx(n, &node.affinity) && node.affinity.Mask)
+      {
+          node.processors = std::bitset<64>(node.affinity.Mask).count();
+          nodes.push_back(node);
+      }
+  }
+
+#elif defined(__linux__)
+  cpu_set_t allowed;
+  std::string online;
+
+  if (   sched_getaffinity(0, sizeof(allowed), &allowed) != 0
+      || !std::getline(std::ifstream("/sys/devices/system/node/online"), online))
+      return nodes;
+
+  for (int n : parse_list(online))
+  {
+      std::string cpus;
+      std::ifstream f("/sys/devices/system/node/node" + std::to_string(n) + "/cpulist");
+      if (!std::getline(f, cpus))
+          continue;
+
+      NumaNode node;
+      CPU_ZERO(&node.affinity);
+      for (int cpu : parse_list(cpus))
+          if (cpu < CPU_SETSIZE && CPU_ISSET(cpu, &allowed))
+              CPU_SET(cpu, &node.affinity);
+
+      node.processors = CPU_COUNT(&node.affinity);
+      if (node.processors)
+          nodes.push_back(node);
+  }
+#endif
+
+  if (nodes.size() < 2)
+      nodes.clear();
+
+  return nodes;
+}
+
+const std::vector<NumaNode>& numa_nodes() {
+
+  static const std::vector<NumaNode> nodes = read_numa_nodes();
+  return nodes;
+}
+
+
+/// numa_node() returns the node search thread idx should be bound to, or -1 if
+/// it should not be bound. Nodes are filled in order up to their number of
+/// logical processors, so that a search with fewer threads than the machine
+/// has keeps to as few nodes (and memory controllers) as possible. Further
+/// threads, if any, are spread round-robin.
+
+int numa_node(size_t idx) {
+
+  const std::vector<NumaNode>& nodes = numa_nodes();
+
+  for (size_t n = 0; n < nodes.size(); ++n)
+  {
+      if (idx < nodes[n].processors)
+          return int(n);
+
+      idx -= nodes[n].processors;
+  }
+
+  return nodes.empty() ? -1 : int(idx % nodes.size());
+}
+
+
+/// bind_this_thread() restricts the calling thread to the logical processors
+/// of the given node, or lets it run on all of them again if node is -1.
+
+void bind_this_thread(int node) {
+
+  const std::vector<NumaNode>& nodes = numa_nodes();
+
+  if (nodes.empty())
+      return;
+
+#if defined(_WIN32)
+  if (node >= 0)
+      SetThreadGroupAffinity(GetCurrentThread(), &nodes[node].affinity, nullptr);
+  else
+  {
+      DWORD_PTR processMask, systemMask;
+      if (GetProcessAffinityMask(GetCurrentProcess(), &processMask, &systemMask))
+          SetThreadAffinityMask(GetCurrentThread(), processMask);
+  }
+
+#elif defined(__linux__)
+  cpu_set_t cpus;
+  CPU_ZERO(&cpus);
+  for (size_t n = 0; n < nodes.size(); ++n)
+      if (node < 0 || int(n) == node)
+          CPU_OR(&cpus, &cpus, &nodes[n].affinity);
+
+  sched_setaffinity(0, sizeof(cpus), &cpus);
+#endif
+}
+
+
+/// spin_until() polls condition for up to Threads.spinTime microseconds and
+/// returns its last value. Waiting this way, before falling back on a condition
+/// variable, avoids the latency of putting a thread to sleep and waking it up
+/// again, which is a noticeable part of very short searches. The thread yields
+/// while spinning, so that it does not starve others when cores are scarce.
+
+template<typename Predicate>
+bool spin_until(Predicate condition) {
+
+  const int spinTime = Threads.spinTime;
+
+  if (spinTime <= 0)
+      return condition();
+
+  const auto end = std::chrono::steady_clock::now() + std::chrono::microseconds(spinTime);
+
+  while (!condition())
+  {
+      if (std::chrono::steady_clock::now() >= end)
+          return condition();
+
+      std::this_thread::yield();
+  }
+  return true;
+}
+
+} // namespace
+
+
 /// Thread constructor launch the thread and then wait until it goes to sleep
-/// in idle_loop().
+/// in idle_loop(). The thread binds itself to NUMA node 'node' (-1 for none)
+/// before its first search.
 
-Thread::Thread() {
+Thread::Thread(int node) {
 
-  resetCalls = exit = false;
+  exit = false;
   maxPly = callsCnt = 0;
+  nodes = 0;
+  numaNode = node;
+  boundNode = -1;
+#ifdef NANOHA
+  mate3Called = mate3HashHit = mate3Override = 0;
+#endif
   history.clear();
   counterMoves.clear();
   idx = Threads.size(); // Start from 0
@@ -68,6 +278,9 @@ Thread::~Thread() {
 
 void Thread::wait_for_search_finished() {
 
+  if (spin_until([&]{ return !searching; }))
+      return;
+
   std::unique_lock<Mutex> lk(mutex);
   sleepCondition.wait(lk, [&]{ return !searching; });
 }
@@ -105,6 +318,15 @@ void Thread::idle_loop() {
 
       searching = false;
 
+      // Spin for a while first, in case a new search is started soon
+      if (Threads.spinTime > 0)
+      {
+          sleepCondition.notify_one(); // Wake up any waiting thread
+          lk.unlock();
+          spin_until([&]{ return searching || exit; });
+          lk.lock();
+      }
+
       while (!searching && !exit)
       {
           sleepCondition.notify_one(); // Wake up any waiting thread
@@ -114,11 +336,46 @@ void Thread::idle_loop() {
       lk.unlock();
 
       if (!exit)
+      {
+          if (boundNode != numaNode)
+              bind_this_thread(boundNode = numaNode);
+
           search();
+      }
   }
 }
 
 
+/// ThreadPool::create() creates search thread idx. When threads are bound, the
+/// Thread object is allocated and cleared by a helper thread that is already
+/// bound to the node, so that its pages (rootPos, history and counter moves
+/// tables) are first touched, and so placed, in the memory of that node.
+
+template<typename T>
+T* ThreadPool::create(size_t idx) {
+
+  const int node = bindThreads ? numa_node(idx) : -1;
+
+  if (node < 0)
+      return new T;
+
+  T* th = nullptr;
+  std::thread([&]{ bind_this_thread(node); th = new T(node); }).join();
+  return th;
+}
+
+
+/// ThreadPool::bind_as() binds the calling thread to the node of search thread
+/// idx, so that memory it touches first is placed as the search threads are.
+/// It does nothing when Thread_Binding is off.
+
+void ThreadPool::bind_as(size_t idx) {
+
+  if (bindThreads)
+      bind_this_thread(numa_node(idx));
+}
+
+
 /// ThreadPool::init() create and launch requested threads, that will go
 /// immediately to sleep. We cannot use a constructor because Threads is a
 /// static object and we need a fully initialized engine at this point due to
@@ -126,7 +383,13 @@ void Thread::idle_loop() {
 
 void ThreadPool::init() {
 
-  push_back(new MainThread);
+  spinTime = Options["Idle_Spin"];
+  bindThreads = Options["Thread_Binding"];
+  push_back(create<MainThread>(0));
+  timer = new TimerThread;
+#ifdef NANOHA
+  mateThread = nullptr;
+#endif
   read_uci_options();
 }
 
@@ -139,6 +402,14 @@ void ThreadPool::exit() {
 
   while (size())
       delete back(), pop_back();
+
+  delete timer;
+  timer = nullptr;
+
+#ifdef NANOHA
+  delete mateThread;
+  mateThread = nullptr;
+#endif
 }
 
 
@@ -149,25 +420,94 @@ void ThreadPool::exit() {
 void ThreadPool::read_uci_options() {
 
   size_t requested = Options["Threads"];
+  bool binding = Options["Thread_Binding"];
 
   assert(requested > 0);
 
+  spinTime = Options["Idle_Spin"];
+
+  // The helper threads are allocated on their node when created, so they are
+  // created again when the binding changes. The main thread is kept, because
+  // positions refer to it, and only moves itself at its next search.
+  if (binding != bindThreads)
+  {
+      while (size() > 1)
+          delete back(), pop_back();
+
+      bindThreads = binding;
+      main()->numaNode = bindThreads ? numa_node(0) : -1;
+  }
+
   while (size() < requested)
-      push_back(new Thread);
+      push_back(create<Thread>(size()));
 
   while (size() > requested)
       delete back(), pop_back();
+
+#ifdef NANOHA
+  if (Options["MateThread"] && !mateThread)
+      mateThread = new MateThread;
+  else if (!Options["MateThread"] && mateThread)
+      delete mateThread, mateThread = nullptr;
+#endif
 }
 
 
-/// ThreadPool::nodes_searched() return the number of nodes searched
+#ifdef NANOHA
+/// run_book_threads() starts count BookThreads running task and returns when
+/// all of them have finished.
+
+void run_book_threads(size_t count, const std::function<void(BookThread&)>& task) {
+
+  std::vector<BookThread*> threads;
+
+  for (size_t i = 0; i < std::max(count, size_t(1)); ++i)
+  {
+      threads.push_back(new BookThread);
+      threads.back()->idx = i;
+      threads.back()->task = task;
+      threads.back()->start_searching();
+  }
+
+  for (BookThread* th : threads)
+  {
+      th->wait_for_search_finished();
+      delete th;
+  }
+}
+#endif
+
+
+/// TimerThread::start() starts checking the limits of the current search and
+/// TimerThread::stop() stops it, returning when the timer thread is idle again.
+
+void TimerThread::start() {
+
+  run = true;
+  start_searching();
+}
+
+void TimerThread::stop() {
+
+  {
+      std::unique_lock<Mutex> lk(timerMutex);
+      run = false;
+  }
+  timerCondition.notify_one();
+  wait_for_search_finished();
+}
+
+
+/// ThreadPool::nodes_searched() return the number of nodes searched, as last
+/// published by each thread. They do it every 1024 calls of search() and at the
+/// end of each root search, so the result is slightly behind while searching.
 
 int64_t ThreadPool::nodes_searched() {
 
-  int64_t nodes = 0;
+  int64_t sum = 0;
   for (Thread* th : *this)
-      nodes += th->rootPos.nodes_searched();
-  return nodes;
+      sum += th->nodes.load(std::memory_order_relaxed);
+  return sum;
 }
 
 
@@ -181,8 +521,18 @@ void ThreadPool::start_thinking(const Position& pos, const LimitsType& limits,
 
   Signals.stopOnPonderhit = Signals.stop = false;
 
+  for (std::atomic<int>& n : depthSearchers)
+      n = 0;
+
+  for (Thread* th : *this)
+      th->nodes = 0;
+
   main()->rootMoves.clear();
   main()->rootPos = pos;
+#ifdef NANOHA
+  if (mateThread)
+      mateThread->rootMateFound = false;
+#endif
   Limits = limits;
   if (states.get()) // If we don't set a new position, preserve current state
   {
@@ -191,14 +541,16 @@ void ThreadPool::start_thinking(const Position& pos, const LimitsType& limits,
   }
 #ifdef NANOHA
   for (MoveList<MV_LEGAL> ml(pos); !ml.end(); ++ml) {
-	  if (limits.searchmoves.empty()
-		  || std::count(limits.searchmoves.begin(), limits.searchmoves.end(), ml.move()))
+	  if (   (limits.searchmoves.empty()
+		      || std::count(limits.searchmoves.begin(), limits.searchmoves.end(), ml.move()))
+		  && !std::count(limits.ignoremoves.begin(), limits.ignoremoves.end(), ml.move()))
 		  main()->rootMoves.push_back(RootMove(ml.move()));
   }
 #else
   for (const auto& m : MoveList<MV_LEGAL>(pos))
-      if (   limits.searchmoves.empty()
-          || std::count(limits.searchmoves.begin(), limits.searchmoves.end(), m))
+      if (   (   limits.searchmoves.empty()
+              || std::count(limits.searchmoves.begin(), limits.searchmoves.end(), m))
+          && !std::count(limits.ignoremoves.begin(), limits.ignoremoves.end(), m))
           main()->rootMoves.push_back(RootMove(m));
 #endif
 
@@ -29,6 +29,7 @@
 #include <atomic>
 #include <bitset>
 #include <condition_variable>
+#include <functional>
 #include <mutex>
 #include <thread>
 #include <vector>
@@ -49,10 +50,10 @@ class Thread {
   std::thread nativeThread;
   Mutex mutex;
   ConditionVariable sleepCondition;
-  bool exit, searching;
+  std::atomic_bool exit, searching; // Atomic, as they are also polled without the lock
 
 public:
-  Thread();
+  explicit Thread(int node = -1);
   virtual ~Thread();
   virtual void search();
   void idle_loop();
@@ -67,6 +68,7 @@ public:
 #endif
   size_t idx, PVIdx;
   int maxPly, callsCnt;
+  int numaNode, boundNode; // Requested and current NUMA node binding, -1 if none
 
   Position rootPos;
   Search::RootMoveVector rootMoves;
@@ -74,13 +76,40 @@ public:
   HistoryStats history;
   MovesStats counterMoves;
   Depth completedDepth;
-  std::atomic_bool resetCalls;
+
+  // Nodes searched, copied from rootPos by the thread itself every so often,
+  // so that other threads can sum them without reading its Position. The
+  // padding keeps the counter on a cache line of its own.
+  char padding0[64];
+  std::atomic<uint64_t> nodes;
+  char padding1[64];
+#ifdef NANOHA
+  uint64_t mate3Called, mate3HashHit, mate3Override; // Summed by analize_mate3()
+#endif
+};
+
+
+/// TimerThread is a thread, not part of the pool, that checks the time and node
+/// limits while the other threads search, so that they never have to.
+
+struct TimerThread : public Thread {
+  static const int Resolution = 1; // Milliseconds
+
+  TimerThread() { run = false; }
+  virtual void search();
+  void start();
+  void stop();
+
+  std::atomic_bool run;
+  Mutex timerMutex;
+  ConditionVariable timerCondition;
 };
 
 
 /// MainThread is a derived class with a specific overload for the main thread
 
 struct MainThread : public Thread {
+  explicit MainThread(int node = -1) : Thread(node) {}
   virtual void search();
 
   bool easyMovePlayed, failedLow;
@@ -88,6 +117,32 @@ struct MainThread : public Thread {
 };
 
 
+#ifdef NANOHA
+/// MateThread is an optional extra thread, not part of the pool, that runs the
+/// df-pn mate solver while the other threads search.
+
+struct MateThread : public Thread {
+  virtual void search();
+
+  std::atomic_bool rootMateFound;
+  std::vector<Move> rootMatePv;
+};
+
+
+/// BookThread is a thread, not part of the pool, used by the book tools. Each
+/// one runs the same task, which pulls work items from shared state, so that
+/// run_book_threads() can spread game replays or searches over several cores.
+
+struct BookThread : public Thread {
+  virtual void search() { task(*this); }
+
+  std::function<void(BookThread&)> task;
+};
+
+void run_book_threads(size_t count, const std::function<void(BookThread&)>& task);
+#endif
+
+
 /// ThreadPool struct handles all the threads related stuff like init, starting,
 /// parking and, most importantly, launching a thread. All the access to threads
 /// data is done through this class.
@@ -100,7 +155,20 @@ struct ThreadPool : public std::vector<Thread*> {
   MainThread* main() { return static_cast<MainThread*>(at(0)); }
   void start_thinking(const Position&, const Search::LimitsType&, Search::StateStackPtr&);
   void read_uci_options();
+  void bind_as(size_t idx);
   int64_t nodes_searched();
+
+#ifdef NANOHA
+  MateThread* mateThread;
+#endif
+  TimerThread* timer;
+  std::atomic<int> spinTime; // Microseconds to spin before sleeping, 0 to not spin
+  std::atomic<int> depthSearchers[DEPTH_MAX + 1]; // Threads searching each root depth
+
+private:
+  template<typename T> T* create(size_t idx);
+
+  bool bindThreads;
 };
 
 extern ThreadPool Threads;
@@ -22,16 +22,305 @@
   along with this program.  If not, see <http://www.gnu.org/licenses/>.
 */
 
+#include <algorithm> // For std::max
 #include <cstring>   // For std::memset
+#include <fstream>
 #include <iostream>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <csignal>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
 
 #ifndef NANOHA
 #include "bitboard.h"
 #endif // !NANOHA
+#include "thread.h"
 #include "tt.h"
 
 TranspositionTable TT; // Our global transposition table
 
+namespace {
+
+/// TTFileHeader is at the start of the files written by TranspositionTable::save().
+/// It is followed by one record per non-empty cluster: the 64 bit cluster index
+/// and then the ClusterSize entries of the cluster (without the padding).
+
+struct TTFileHeader {
+  char     magic[8];
+  uint32_t entrySize;
+  uint32_t clusterSize;
+  uint64_t clusterCount;
+  uint8_t  generation8;
+  char     padding[7];
+};
+
+const char TTFileMagic[8] = "USP2TT1";
+
+} // namespace
+
+#if defined(__linux__)
+namespace {
+
+const size_t HugePageSize = 2 * 1024 * 1024;
+const int MemPolicyInterleave = 3;  // MPOL_INTERLEAVE
+const int MemsAllowed = 4;          // MPOL_F_MEMS_ALLOWED
+
+/// interleave_table() spreads the pages of the table round-robin over all the
+/// NUMA nodes we are allowed to use, so that on multi-socket machines it is not
+/// served by a single memory controller. It must be called before the pages
+/// are touched for the first time, and it is best effort.
+
+void interleave_table(void* mem, size_t size) {
+
+  unsigned long nodes[16] = {};
+  const unsigned long maxNode = sizeof(nodes) * 8;
+  if (syscall(SYS_get_mempolicy, nullptr, nodes, maxNode, nullptr, MemsAllowed) == 0)
+      syscall(SYS_mbind, mem, size, MemPolicyInterleave, nodes, maxNode, 0);
+}
+
+
+/// map_table() allocates zeroed memory for the table with mmap(). With large
+/// pages it first tries explicit huge pages (MAP_HUGETLB, which need pages
+/// reserved in /proc/sys/vm/nr_hugepages) and then falls back to transparent
+/// huge pages, which is best effort.
+
+void* map_table(size_t size, bool largePages, bool numaInterleave) {
+
+  void* mem = MAP_FAILED;
+
+#ifdef MAP_HUGETLB
+  if (largePages)
+      mem = mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                 MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+#endif
+
+  if (mem == MAP_FAILED)
+  {
+      mem = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+      if (mem == MAP_FAILED)
+          return nullptr;
+
+#ifdef MADV_HUGEPAGE
+      if (largePages)
+          madvise(mem, size, MADV_HUGEPAGE);
+#endif
+  }
+
+  if (numaInterleave)
+      interleave_table(mem, size);
+
+  return mem;
+}
+
+
+/// A table in shared memory is followed by a SharedTableHeader. 'ready' is set
+/// by the creator once the table is cleared, and the other processes wait for
+/// it before using the table. 'pids' holds the attached processes, the creator
+/// first, so that the last one can remove the segment. Since a process that
+/// crashes never releases its slot, slots of dead processes are reclaimed by
+/// the next attach and ignored by the last detach.
+
+const size_t SharedHeaderSize = 64;
+const int MaxSharedUsers = 15;
+const uint32_t SharedReadyMagic = 0x55535932; // "USY2"
+
+struct SharedTableHeader {
+  std::atomic<uint32_t> ready;
+  std::atomic<int32_t> pids[MaxSharedUsers];
+};
+
+static_assert(sizeof(SharedTableHeader) <= SharedHeaderSize, "SharedTableHeader too big");
+
+SharedTableHeader* shared_header(void* mem, size_t mappedSize) {
+  return (SharedTableHeader*)((char*)mem + mappedSize - SharedHeaderSize);
+}
+
+bool process_alive(int32_t pid) {
+  return pid > 0 && (kill(pid, 0) == 0 || errno == EPERM);
+}
+
+
+/// claim_shared_slot() records the calling process in a free slot, freeing the
+/// slots of dead processes first. Fails if MaxSharedUsers processes are alive.
+
+bool claim_shared_slot(SharedTableHeader* h) {
+
+  const int32_t self = int32_t(getpid());
+
+  for (int i = 0; i < MaxSharedUsers; ++i)
+  {
+      int32_t pid = h->pids[i];
+      if (pid && !process_alive(pid))
+          h->pids[i].compare_exchange_strong(pid, 0);
+  }
+
+  for (int i = 0; i < MaxSharedUsers; ++i)
+  {
+      int32_t expected = 0;
+      if (h->pids[i].compare_exchange_strong(expected, self))
+          return true;
+  }
+  return false;
+}
+
+
+/// other_shared_users() returns true if a live process other than the calling
+/// one is attached to the segment.
+
+bool other_shared_users(const SharedTableHeader* h) {
+
+  const int32_t self = int32_t(getpid());
+
+  for (int i = 0; i < MaxSharedUsers; ++i)
+  {
+      const int32_t pid = h->pids[i];
+      if (pid != self && process_alive(pid))
+          return true;
+  }
+  return false;
+}
+
+
+/// release_shared_slot() frees the slot of the calling process and returns true
+/// if no live process is attached to the segment any more.
+
+bool release_shared_slot(SharedTableHeader* h) {
+
+  const int32_t self = int32_t(getpid());
+
+  for (int i = 0; i < MaxSharedUsers; ++i)
+  {
+      int32_t pid = self;
+      h->pids[i].compare_exchange_strong(pid, 0);
+  }
+  return !other_shared_users(h);
+}
+
+
+/// attach_shared_table() maps the POSIX shared memory segment 'name' holding a
+/// table of 'size' bytes, and creates it if it does not exist yet ('created' is
+/// then set). Several engine processes attached to the same segment share their
+/// search results; TTEntry::save() already tolerates concurrent writers. Fails
+/// if the segment exists with another size, i.e. another Hash value. The
+/// creator must call publish_shared_table() once it has cleared the table. A
+/// segment left unready by a creator that died is stale, and is replaced.
+
+void* attach_shared_table(const std::string& name, size_t size, bool largePages,
+                          bool numaInterleave, bool& created) {
+
+  const size_t total = size + SharedHeaderSize;
+
+  for (int attempt = 0; attempt < 2; ++attempt)
+  {
+      int fd = shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+      created = fd >= 0;
+
+      if (created)
+      {
+          if (ftruncate(fd, total) != 0)
+          {
+              close(fd);
+              shm_unlink(name.c_str());
+              return nullptr;
+          }
+      }
+      else
+      {
+          fd = shm_open(name.c_str(), O_RDWR, 0600);
+          if (fd < 0)
+              return nullptr;
+
+          // The process creating the segment may not have set its size yet
+          struct stat st;
+          for (int i = 0; i < 100 && fstat(fd, &st) == 0 && st.st_size == 0; ++i)
+              std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+          if (fstat(fd, &st) != 0 || size_t(st.st_size) != total)
+          {
+              close(fd);
+              if (st.st_size != 0)
+                  return nullptr;
+
+              shm_unlink(name.c_str()); // Its creator died before sizing it
+              continue;
+          }
+      }
+
+      void* mem = mmap(nullptr, total, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+      close(fd);
+
+      if (mem == MAP_FAILED)
+      {
+          if (created)
+              shm_unlink(name.c_str());
+          return nullptr;
+      }
+
+#ifdef MADV_HUGEPAGE
+      if (largePages)
+          madvise(mem, size, MADV_HUGEPAGE);
+#endif
+
+      SharedTableHeader* h = shared_header(mem, total);
+
+      if (created)
+      {
+          h->pids[0] = int32_t(getpid());
+
+          if (numaInterleave)
+              interleave_table(mem, size);
+
+          return mem;
+      }
+
+      // Wait until the creator has cleared the table, unless it died before
+      for (int i = 0; h->ready != SharedReadyMagic; ++i)
+      {
+          const int32_t creator = h->pids[0];
+          if (creator ? !process_alive(creator) : i >= 100)
+              break;
+
+          std::this_thread::sleep_for(std::chrono::milliseconds(10));
+      }
+
+      if (h->ready == SharedReadyMagic)
+      {
+          if (claim_shared_slot(h))
+              return mem;
+
+          munmap(mem, total);
+          return nullptr;
+      }
+
+      munmap(mem, total);
+      shm_unlink(name.c_str());
+  }
+
+  return nullptr;
+}
+
+
+/// publish_shared_table() lets the other processes use a segment created by
+/// attach_shared_table().
+
+void publish_shared_table(void* mem, size_t mappedSize) {
+
+  shared_header(mem, mappedSize)->ready = SharedReadyMagic;
+}
+
+} // namespace
+#endif
+
 
 /// TranspositionTable::resize() sets the size of the transposition table,
 /// measured in megabytes. Transposition table consists of a power of 2 number
@@ -46,8 +335,34 @@ void TranspositionTable::resize(size_t mbSize) {
 
   clusterCount = newClusterCount;
 
-  free(mem);
+  free_table();
+
+  bool created = true;
+
+#if defined(__linux__)
+  // Whole huge pages, which also keeps the table aligned to a cache line
+  const size_t size = (clusterCount * sizeof(Cluster) + HugePageSize - 1) & ~(HugePageSize - 1);
+
+  if (!sharedName.empty())
+  {
+      mem = attach_shared_table(sharedName, size, largePages, numaInterleave, created);
+      shared = mem != nullptr;
+      if (shared)
+          mappedSize = size + SharedHeaderSize;
+      else
+          std::cerr << "Failed to attach shared hash " << sharedName
+                    << ", using a private one." << std::endl;
+  }
+
+  if (!mem)
+  {
+      created = true;
+      mem = map_table(size, largePages, numaInterleave);
+      mappedSize = mem ? size : 0;
+  }
+#else
   mem = calloc(clusterCount * sizeof(Cluster) + CacheLineSize - 1, 1);
+#endif
 
   if (!mem)
   {
@@ -57,16 +372,101 @@ void TranspositionTable::resize(size_t mbSize) {
   }
 
   table = (Cluster*)((uintptr_t(mem) + CacheLineSize - 1) & ~(CacheLineSize - 1));
+
+  // The memory is already zeroed, but clearing it in parallel makes the pages
+  // be touched first by workers bound as the search threads are, which with
+  // Thread_Binding spreads the table over the nodes of the search threads.
+  // A shared table that other processes already use is kept as it is, and a
+  // new one is published only once cleared.
+  if (created)
+      clear();
+
+#if defined(__linux__)
+  if (shared && created)
+      publish_shared_table(mem, mappedSize);
+#endif
+}
+
+
+/// TranspositionTable::set_alloc_policy() selects whether the table should use
+/// huge pages, be interleaved across NUMA nodes and be put in the POSIX shared
+/// memory segment 'name' (empty or "<empty>" for a private table). All of them
+/// are currently only supported on Linux. A table already allocated is
+/// released, so resize() must be called after it.
+
+void TranspositionTable::set_alloc_policy(bool lp, bool ni, const std::string& name) {
+
+  std::string sn = name == "<empty>" ? "" : name;
+  if (!sn.empty() && sn[0] != '/')
+      sn = "/" + sn; // Required by shm_open()
+
+  if (lp == largePages && ni == numaInterleave && sn == sharedName)
+      return;
+
+  free_table();
+  largePages = lp;
+  numaInterleave = ni;
+  sharedName = sn;
+  clusterCount = 0;
+}
+
+
+/// TranspositionTable::free_table() releases the memory of the table
+
+void TranspositionTable::free_table() {
+
+#if defined(__linux__)
+  // The last live process using a shared table removes it
+  if (shared && release_shared_slot(shared_header(mem, mappedSize)))
+      shm_unlink(sharedName.c_str());
+
+  if (mappedSize)
+      munmap(mem, mappedSize);
+  else
+#endif
+      free(mem);
+
+  mem = nullptr;
+  table = nullptr;
+  mappedSize = 0;
+  shared = false;
 }
 
 
 /// TranspositionTable::clear() overwrites the entire transposition table
 /// with zeros. It is called whenever the table is resized, or when the
 /// user asks the program to clear the table (from the UCI interface).
+/// The work is split over as many threads as the search uses, since a
+/// single memset of a large table can take several seconds. Each worker
+/// is bound to the node of the search thread with the same index. A shared
+/// table is left as it is while other live processes use it, since they
+/// may be searching with it.
 
 void TranspositionTable::clear() {
 
-  std::memset(table, 0, clusterCount * sizeof(Cluster));
+#if defined(__linux__)
+  if (shared && other_shared_users(shared_header(mem, mappedSize)))
+      return;
+#endif
+
+  const size_t threadCount = std::max(Threads.size(), size_t(1));
+  std::vector<std::thread> threads;
+
+  for (size_t idx = 0; idx < threadCount; ++idx)
+      threads.emplace_back([this, idx, threadCount]() {
+
+          Threads.bind_as(idx);
+
+          // Each thread zeroes its own part of the table
+          const size_t stride = clusterCount / threadCount,
+                       start  = stride * idx,
+                       len    = idx != threadCount - 1 ? stride : clusterCount - start;
+
+          std::memset(&table[start], 0, len * sizeof(Cluster));
+      });
+
+  for (std::thread& th : threads)
+      th.join();
 }
 
 
@@ -80,15 +480,15 @@ void TranspositionTable::clear() {
 TTEntry* TranspositionTable::probe(const Key key, bool& found) const {
 
   TTEntry* const tte = first_entry(key);
-  const uint32_t key32 = key >> 32;  // Use the high 32 bits as key inside the cluster
+  const uint16_t key16 = key >> 48;  // Use the high 16 bits as key inside the cluster
 
   for (int i = 0; i < ClusterSize; ++i)
-      if (!tte[i].key32 || tte[i].key32 == key32)
+      if (!tte[i].key16 || tte[i].key16 == key16)
       {
-          if ((tte[i].genBound8 & 0xFC) != generation8 && tte[i].key32)
+          if ((tte[i].genBound8 & 0xFC) != generation8 && tte[i].key16)
               tte[i].genBound8 = uint8_t(generation8 | tte[i].bound()); // Refresh
 
-          return found = (bool)tte[i].key32, &tte[i];
+          return found = (bool)tte[i].key16, &tte[i];
       }
 
   // Find an entry to be replaced according to the replacement strategy
@@ -106,18 +506,125 @@ TTEntry* TranspositionTable::probe(const Key key, bool& found) const {
 }
 
 
+/// TranspositionTable::save() writes the non-empty clusters of the table to a
+/// file, so that a later session can start from what this one has searched.
+/// It must not be called while searching.
+
+bool TranspositionTable::save(const std::string& fname) const {
+
+  std::ofstream ofs(fname, std::ios::binary);
+  if (!ofs)
+      return false;
+
+  TTFileHeader h = {};
+  std::memcpy(h.magic, TTFileMagic, sizeof(h.magic));
+  h.entrySize    = sizeof(TTEntry);
+  h.clusterSize  = ClusterSize;
+  h.clusterCount = clusterCount;
+  h.generation8  = generation8;
+  ofs.write((const char*)&h, sizeof(h));
+
+  for (size_t i = 0; i < clusterCount; ++i)
+  {
+      const TTEntry* tte = &table[i].entry[0];
+      bool used = false;
+      for (int j = 0; j < ClusterSize; ++j)
+          used |= tte[j].key16 != 0;
+
+      if (used)
+      {
+          const uint64_t idx = i;
+          ofs.write((const char*)&idx, sizeof(idx));
+          ofs.write((const char*)tte, ClusterSize * sizeof(TTEntry));
+      }
+  }
+
+  return bool(ofs.flush());
+}
+
+
+/// TranspositionTable::load() reads a file written by save() into the current
+/// table. The generation of the saved entries is shifted so that they keep
+/// their age relative to the current generation. The table may be smaller
+/// than the saved one: the low bits of a saved cluster index are then still
+/// the index of its positions, and the entries are merged there with the
+/// replacement strategy of probe(). A larger table is refused, because the
+/// cluster of a saved entry can not be known without the lost key bits. It
+/// must not be called while searching.
+
+bool TranspositionTable::load(const std::string& fname) {
+
+  std::ifstream ifs(fname, std::ios::binary);
+  TTFileHeader h;
+
+  if (   !ifs.read((char*)&h, sizeof(h))
+      || std::memcmp(h.magic, TTFileMagic, sizeof(h.magic))
+      || h.entrySize != sizeof(TTEntry)
+      || h.clusterSize != ClusterSize
+      || !h.clusterCount
+      || (h.clusterCount & (h.clusterCount - 1))
+      ||  h.clusterCount < clusterCount)
+      return false;
+
+  // Same formula as in probe()
+  auto worth = [this](const TTEntry& e) {
+      return e.depth8 - ((259 + generation8 - e.genBound8) & 0xFC) * 2 * ONE_PLY;
+  };
+
+  auto merge = [&](TTEntry* tte, const TTEntry& e) {
+      TTEntry* replace = tte;
+      for (int i = 0; i < ClusterSize; ++i)
+      {
+          if (!tte[i].key16 || tte[i].key16 == e.key16)
+          {
+              if (!tte[i].key16 || e.depth8 > tte[i].depth8)
+                  tte[i] = e;
+              return;
+          }
+          if (worth(tte[i]) < worth(*replace))
+              replace = &tte[i];
+      }
+      if (worth(e) > worth(*replace))
+          *replace = e;
+  };
+
+  // Generations are multiples of 4, so the bound bits are not affected
+  const uint8_t shift = uint8_t(generation8 - h.generation8);
+  uint64_t idx;
+  TTEntry saved[ClusterSize];
+
+  while (ifs.read((char*)&idx, sizeof(idx)))
+  {
+      if (   !ifs.read((char*)saved, sizeof(saved))
+          || idx >= h.clusterCount)
+          return false;
+
+      for (TTEntry& e : saved)
+          e.genBound8 = uint8_t(e.genBound8 + shift);
+
+      for (const TTEntry& e : saved)
+          if (e.key16)
+              merge(&table[idx & (clusterCount - 1)].entry[0], e);
+  }
+
+  // A file truncated in the middle of a cluster record is an error
+  return ifs.eof() && ifs.gcount() == 0;
+}
+
+
 /// Returns an approximation of the hashtable occupation during a search. The
 /// hash is x permill full, as per UCI protocol.
 
 int TranspositionTable::hashfull() const
 {
+  // 1000 clusters hold 1000 * ClusterSize entries
   int cnt = 0;
-  for (int i = 0; i < 1000 / ClusterSize; i++)
+  for (int i = 0; i < 1000; i++)
   {
       const TTEntry* tte = &table[i].entry[0];
       for (int j = 0; j < ClusterSize; j++)
           if ((tte[j].genBound8 & 0xFC) == generation8)
               cnt++;
   }
-  return cnt;
+  return cnt / ClusterSize;
 }
@@ -25,10 +25,11 @@
 #ifndef TT_H_INCLUDED
 #define TT_H_INCLUDED
 
+#include <string>
+
 #include "misc.h"
 #include "types.h"
 
-#ifndef NANOHA
 /// TTEntry struct is the 10 bytes transposition table entry, defined as below:
 ///
 /// key        16 bit
@@ -38,22 +39,39 @@
 /// generation  6 bit
 /// bound type  2 bit
 /// depth       8 bit
-#else
-/// TTEntry struct is the 14 bytes transposition table entry, defined as below:
 ///
-/// key        32 bit
-/// move       32 bit
-/// value      16 bit
-/// eval value 16 bit
-/// generation  6 bit
-/// bound type  2 bit
-/// depth       8 bit
+/// Under NANOHA the move is stored in the packed form of pack_move(). move()
+/// returns it as is and Position::unpack_move() turns it back into a Move that
+/// is valid for the probing position, or MOVE_NONE.
+
+#ifdef NANOHA
+/// pack_move() squeezes a Move into the 16 bit form stored in a TTEntry:
+///
+/// bit  0- 6  destination square (0..80)
+/// bit  7-13  origin square (0..80), or 81 + piece type for a drop
+/// bit 14     promotion flag
+///
+/// The moved and captured pieces are recovered from the board by
+/// Position::unpack_move(). The MOVE_CHECK_* flags are lost, search never stores
+/// a move carrying them.
+
+inline uint16_t pack_move(Move m) {
+  if (m == MOVE_NONE || m == MOVE_NULL)
+      return 0;
+
+  int from = move_is_drop(m) ? 81 + (move_piece(m) & ~GOTE) : conv_z2sq(move_from(m));
+  return uint16_t(conv_z2sq(move_to(m)) | (from << 7) | (is_promotion(m) ? 1 << 14 : 0));
+}
 #endif
 
 #pragma pack(1)
 struct TTEntry {
 
-  Move  move()  const { return (Move )move32; }
+#ifdef NANOHA
+  uint16_t move() const { return move16; }
+#else
+  Move  move()  const { return (Move )move16; }
+#endif
   Value value() const { return (Value)value16; }
   Value eval()  const { return (Value)eval16; }
   Depth depth() const { return (Depth)depth8; }
@@ -62,16 +80,20 @@ struct TTEntry {
   void save(Key k, Value v, Bound b, Depth d, Move m, Value ev, uint8_t g) {
 
     // Preserve any existing move for the same position
-    if (m || (k >> 32) != key32)
-        move32 = (uint32_t)m;
+    if (m || (k >> 48) != key16)
+#ifdef NANOHA
+        move16 = pack_move(m);
+#else
+        move16 = (uint16_t)m;
+#endif
 
     // Don't overwrite more valuable entries
-    if (  (k >> 32) != key32
+    if (  (k >> 48) != key16
         || d > depth8 - 2
      /* || g != (genBound8 & 0xFC) // Matching non-zero keys are already refreshed by probe() */
         || b == BOUND_EXACT)
     {
-        key32     = (uint32_t)(k >> 32);
+        key16     = (uint16_t)(k >> 48);
         value16   = (int16_t)v;
         eval16    = (int16_t)ev;
         genBound8 = (uint8_t)(g | b);
@@ -82,8 +104,8 @@ struct TTEntry {
 private:
   friend class TranspositionTable;
 
-  uint32_t key32;
-  uint32_t move32;
+  uint16_t key16;
+  uint16_t move16;
   int16_t  value16;
   int16_t  eval16;
   uint8_t  genBound8;
@@ -101,24 +123,27 @@ private:
 class TranspositionTable {
 
   static const int CacheLineSize = 64;
-  static const int ClusterSize = 4;
+  static const int ClusterSize = 6;
 
   struct Cluster {
     TTEntry entry[ClusterSize];
-    char padding[8]; // Align to a divisor of the cache line size
+    char padding[4]; // Align to a divisor of the cache line size
   };
 
-  static_assert(sizeof(TTEntry)==14,"TTEntry size !=14");
+  static_assert(sizeof(TTEntry)==10,"TTEntry size !=10");
   static_assert(CacheLineSize % sizeof(Cluster) == 0, "Cluster size incorrect");
 
 public:
- ~TranspositionTable() { free(mem); }
+ ~TranspositionTable() { free_table(); }
   void new_search() { generation8 += 4; } // Lower 2 bits are used by Bound
   uint8_t generation() const { return generation8; }
   TTEntry* probe(const Key key, bool& found) const;
   int hashfull() const;
   void resize(size_t mbSize);
+  void set_alloc_policy(bool largePages, bool numaInterleave, const std::string& sharedName);
   void clear();
+  bool save(const std::string& fname) const;
+  bool load(const std::string& fname);
 
   // The lowest order bits of the key are used to get the index of the cluster
   TTEntry* first_entry(const Key key) const {
@@ -126,9 +151,16 @@ public:
   }
 
 private:
+  void free_table();
+
   size_t clusterCount;
   Cluster* table;
   void* mem;
+  size_t mappedSize; // Non-zero when mem comes from mmap()
+  bool largePages;
+  bool numaInterleave;
+  bool shared;       // True when mem is the shared memory segment sharedName
+  std::string sharedName;
   uint8_t generation8; // Size must be not bigger than TTEntry::genBound8
 };
 
@@ -22,6 +22,7 @@
   along with this program.  If not, see <http://www.gnu.org/licenses/>.
 */
 
+#include <algorithm>
 #include <iostream>
 #include <sstream>
 #include <string>
@@ -35,11 +36,17 @@
 #include "search.h"
 #include "thread.h"
 #include "timeman.h"
+#include "tt.h"
 #include "uci.h"
 
 using namespace std;
 
 extern void benchmark(const Position& pos, istream& is);
+#ifdef NANOHA
+extern void bench_tsume(istream& is);
+extern void make_book(istream& is);
+extern void book_think(istream& is);
+#endif
 vector<Move> vIgnoreMoves;
 vector<Move> vForceMove;
 
@@ -51,28 +58,6 @@ void clearIgnoreMoves() {
 void clearForceMove() {
 	vForceMove.clear();
 }
-
-bool isIgnoreMove(Move m) {
-	for (auto itr = vIgnoreMoves.begin(); itr != vIgnoreMoves.end(); ++itr) {
-		if (*itr == m) {
-			return true;
-		}
-	}
-	return false;
-}
-
-bool isForceMove(Move m) {
-	// 肪ȂꍇAtrueԂ
-	if (vForceMove.size() == 0) {
-		return true;
-	}
-	for (auto itr = vForceMove.begin(); itr != vForceMove.end(); ++itr) {
-		if (*itr == m) {
-			return true;
-		}
-	}
-	return false;
-}
 #endif
 
 namespace {
@@ -253,13 +238,97 @@ namespace {
 #else
 		else if (token == "movetime")  is >> limits.movetime;
 #endif
+#ifdef NANOHA
+        else if (token == "mate") {
+            // l̉𓚁B(ms) infinite
+            is >> token;
+            limits.mate = (token == "infinite") ? INT_MAX : std::max(atoi(token.c_str()), 1);
+        }
+#else
         else if (token == "mate")      is >> limits.mate;
+#endif
         else if (token == "infinite")  limits.infinite = 1;
         else if (token == "ponder")    limits.ponder = 1;
 
+#ifdef USAPYON2
+    // ignore_moves, force_move Ŏw肳ꂽ̓[g̎̑Iɔf
+    limits.ignoremoves = vIgnoreMoves;
+    if (!vForceMove.empty()) {
+        if (limits.searchmoves.empty())
+            limits.searchmoves = vForceMove;
+        else
+            limits.searchmoves.erase(std::remove_if(limits.searchmoves.begin(), limits.searchmoves.end(),
+                                                    [](Move m) { return !std::count(vForceMove.begin(), vForceMove.end(), m); }),
+                                     limits.searchmoves.end());
+    }
+#endif
+
     Threads.start_thinking(pos, limits, SetupStates);
   }
 
+#ifdef USAPYON2
+  // NX^̃}X^[󂯎jobT
+  //
+  //  job <id> [searchmoves <move>...] [ignoremoves <move>...] [alpha <cp>] [beta <cp>]
+  //           [depth <n>] [nodes <n>] [movetime <ms>] [infinite]
+  //
+  // T郋[g̎(searchmoves, ignoremoves)ATA[w肵āA݂̋ǖʂTB
+  // Tinfo "info job <id> ..." ƂđAI bestmove ̑O
+  //
+  //  jobdone <id> bestmove <move> score cp <x> [lowerbound|upperbound] depth <n> nodes <n> time <ms>
+  //
+  // 𑗂B̊O̕]l lowerbound / upperbound ̕tElɂȂB
+  // depth, nodes, movetime ̂ǂw肵Ȃ stop ܂ŒTB
+  // ignore_moves, force_move ̎w͎gȂB
+  void job(const Position& pos, istringstream& is) {
+
+    Search::LimitsType limits;
+    vector<Move>* moves = nullptr;
+    string token;
+    int cp;
+
+    limits.startTime = now(); // As early as possible!
+
+    if (!(is >> limits.job)) {
+        sync_cout << "info string job <id> [searchmoves <move>...] [ignoremoves <move>...]"
+                  << " [alpha <cp>] [beta <cp>] [depth <n>] [nodes <n>] [movetime <ms>] [infinite]" << sync_endl;
+        return;
+    }
+
+    while (is >> token)
+        if (token == "searchmoves")      moves = &limits.searchmoves;
+        else if (token == "ignoremoves") moves = &limits.ignoremoves;
+        else if (token == "alpha")       { is >> cp; limits.alpha = Value(cp * DPawn / 100); }
+        else if (token == "beta")        { is >> cp; limits.beta  = Value(cp * DPawn / 100); }
+        else if (token == "depth")       is >> limits.depth;
+        else if (token == "nodes")       is >> limits.nodes;
+        else if (token == "movetime")    is >> limits.movetime;
+        else if (token == "infinite")    limits.infinite = 1;
+        else if (moves)
+        {
+            // ǂ߂Ȃ肪΁AT肪ςĂ܂̂job󂯕tȂ
+            const Move m = UCI::to_move(pos, token);
+            if (m == MOVE_NONE) {
+                sync_cout << "info string job " << limits.job << ": bad move " << token << sync_endl;
+                return;
+            }
+            moves->push_back(m);
+        }
+
+    limits.alpha = std::max(limits.alpha, -VALUE_INFINITE);
+    limits.beta  = std::min(limits.beta,   VALUE_INFINITE);
+    if (limits.alpha >= limits.beta) {
+        sync_cout << "info string job " << limits.job << ": empty window, searching with a full one" << sync_endl;
+        limits.alpha = -VALUE_INFINITE;
+        limits.beta  =  VALUE_INFINITE;
+    }
+    if (!limits.depth && !limits.nodes && !limits.movetime)
+        limits.infinite = 1;
+
+    Threads.start_thinking(pos, limits, SetupStates);
+  }
+#endif
+
 } // namespace
 
 
@@ -336,6 +405,7 @@ void UCI::loop(int argc, char* argv[]) {
 #ifdef USAPYON2
 	  else if (token == "ignore_moves")   ignoreMoves(pos, is);
 	  else if (token == "force_move")   forceMove(pos, is);
+	  else if (token == "job")          job(pos, is);
 #endif
       else if (token == "setoption")  setoption(is);
 
@@ -344,7 +414,21 @@ void UCI::loop(int argc, char* argv[]) {
 	  else if (token == "flip")       pos.flip();
 #endif
       else if (token == "bench")      benchmark(pos, is);
+#ifdef NANOHA
+      else if (token == "tsume")      bench_tsume(is);
+      else if (token == "makebook")   make_book(is);
+      else if (token == "bookthink")  book_think(is);
+#endif
       else if (token == "d")          sync_cout << pos << sync_endl;
+      else if (token == "tt_save" || token == "tt_load")
+      {
+          // The file name is the rest of the line and may contain spaces
+          string file;
+          getline(is >> ws, file);
+          const bool ok = token == "tt_save" ? TT.save(file) : TT.load(file);
+          sync_cout << "info string " << token << " " << file
+                    << (ok ? " done" : " failed") << sync_endl;
+      }
 #ifndef NANOHA
       else if (token == "eval")       sync_cout << Eval::trace(pos) << sync_endl;
 	  else if (token == "perft")
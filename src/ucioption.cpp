@@ -26,6 +26,10 @@
 #include <cassert>
 #include <ostream>
 
+#ifdef NANOHA
+#include "dfpn.h"
+#endif
+#include "evaluate.h"
 #include "misc.h"
 #include "search.h"
 #include "thread.h"
@@ -44,8 +48,20 @@ namespace UCI {
 /// 'On change' actions, triggered by an option's value change
 void on_clear_hash(const Option&) { Search::clear(); }
 void on_hash_size(const Option& o) { TT.resize(o); }
+void on_tt_alloc(const Option&) {
+  TT.set_alloc_policy(Options["Large_Pages"], Options["NUMA_Interleave"], Options["Shared_Hash"]);
+  TT.resize(Options["Hash"]);
+}
 void on_logger(const Option& o) { start_logger(o); }
 void on_threads(const Option&) { Threads.read_uci_options(); }
+#ifdef NANOHA
+void on_mate_hash_size(const Option& o) { MateSearch.resize(o); }
+void on_mate3_hash_size(const Option& o) { resize_mate3_hash(o); }
+void on_mate7_hash_size(const Option& o) { resize_mate7_hash(o); }
+#endif
+#if defined(EVAL_APERY) && defined(TWIG)
+void on_eval_hash_size(const Option& o) { Eval::resize_hash(o); }
+#endif
 #ifndef NANOHA
 void on_tb_path(const Option& o) { Tablebases::init(o); }
 #endif
@@ -67,7 +83,17 @@ void init(OptionsMap& o) {
   o["Write_Debug_Log"]       << Option(false, on_logger);
   o["Contempt"]              << Option(0, -100, 100);
   o["Threads"]               << Option(1, 1, 128, on_threads);
+  o["Thread_Binding"]        << Option(false, on_threads);
+  o["Idle_Spin"]             << Option(0, 0, 100000, on_threads);
+  o["SMP_Depth_Skip"]        << Option(true);
+  o["SMP_Max_Per_Depth"]     << Option(0, 0, 128);
+  o["SMP_Root_Offset"]       << Option(true);
   o["Hash"]                  << Option(256, 1, MaxHashMB, on_hash_size);
+  o["Large_Pages"]           << Option(true, on_tt_alloc);
+  o["NUMA_Interleave"]       << Option(false, on_tt_alloc);
+  // Shared_Hash: processes with the same name and Hash share one table. Clear_Hash
+  // and usinewgame only clear it when no other live process is attached.
+  o["Shared_Hash"]           << Option("<empty>", on_tt_alloc);
   o["Clear_Hash"]            << Option(on_clear_hash);
   o["Ponder"]                << Option(true);
   o["MultiPV"]               << Option(1, 1, 500);
@@ -80,8 +106,18 @@ void init(OptionsMap& o) {
   o["ByoyomiMargin"]		 << Option(800, 0, 3000);
   o["BookFile"]				 << Option("book_40.jsk");
   o["BookFileW"]			 << Option("book_40_2.jsk");
+  o["BookEvalMargin"]		 << Option(150, 0, 100000);
   o["RandomBookSelect"]		 << Option(true);
   o["OwnBook"]				 << Option(true);
+  o["MateHash"]				 << Option(64, 1, 4096, on_mate_hash_size);
+  o["MateNodes"]			 << Option(0, 0, INT_MAX);
+  o["MateThread"]			 << Option(false, on_threads);
+  o["Mate3Hash"]			 << Option(8, 1, 1024, on_mate3_hash_size);
+  o["Mate7Nodes"]			 << Option(2000, 0, 1000000);
+  o["Mate7Hash"]			 << Option(8, 1, 1024, on_mate7_hash_size);
+#endif
+#if defined(EVAL_APERY) && defined(TWIG)
+  o["EvalHash"]				 << Option(64, 0, 4096, on_eval_hash_size);
 #endif
 #ifndef NANOHA
   o["UCI_Chess960"]          << Option(false);